@@ -0,0 +1,100 @@
+// AppUtils.hpp
+//
+// Command-line and output helpers shared by the bench and work_precision apps.
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Parse "--option value" and "--flag" arguments
+ *
+ * on_flag(arg) is tried first, then on_value(arg, next argument); each
+ * returns false if it does not know arg. Unknown options, value options
+ * given last without a value, and values on_value cannot convert
+ * (std::logic_error, e.g. from std::stoul) throw std::invalid_argument.
+ */
+inline void parse_args(
+    int argc, char** argv, const std::string& app,
+    const std::function<bool(const std::string&, const std::string&)>& on_value,
+    const std::function<bool(const std::string&)>& on_flag)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (on_flag(arg)) continue;
+        if (i + 1 < argc) {
+            bool known = false;
+            try {
+                known = on_value(arg, argv[i + 1]);
+            } catch (const std::logic_error&) {
+                // std::stoul and friends on a malformed value
+                throw std::invalid_argument(app + ": bad value '" + argv[i + 1] + "' for " + arg);
+            }
+            if (known) {
+                ++i;
+                continue;
+            }
+        }
+        throw std::invalid_argument(app + ": unknown or incomplete option " + arg);
+    }
+}
+
+/// CSV field, quoted when it holds a comma, quote or line break
+inline std::string csv_escape(const std::string& s) {
+    if (s.find_first_of(",\"\r\n") == std::string::npos) return s;
+    std::string t = "\"";
+    for (char c : s) t += (c == '"') ? "\"\"" : std::string(1, c);
+    return t + "\"";
+}
+
+/// Contents of a JSON string: quotes, backslashes and all control characters escaped
+inline std::string json_escape(const std::string& s) {
+    std::string t;
+    t.reserve(s.size());
+    for (char ch : s) {
+        const unsigned char c = static_cast<unsigned char>(ch);
+        switch (ch) {
+        case '"':  t += "\\\""; break;
+        case '\\': t += "\\\\"; break;
+        case '\b': t += "\\b"; break;
+        case '\f': t += "\\f"; break;
+        case '\n': t += "\\n"; break;
+        case '\r': t += "\\r"; break;
+        case '\t': t += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                t += buf;
+            } else {
+                t.push_back(ch);
+            }
+        }
+    }
+    return t;
+}
+
+/// JSON number with full precision; NaN and infinities become null
+inline std::string json_number(double v) {
+    if (!std::isfinite(v)) return "null";
+    std::ostringstream oss;
+    oss << std::setprecision(17) << v;
+    return oss.str();
+}
+
+/// Open path for writing (creating parent directories), full double precision
+inline std::ofstream open_output(const std::string& path) {
+    namespace fs = std::filesystem;
+    fs::path p(path);
+    if (p.has_parent_path()) fs::create_directories(p.parent_path());
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("Cannot open output: " + path);
+    out << std::setprecision(17);
+    return out;
+}
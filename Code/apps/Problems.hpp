@@ -0,0 +1,45 @@
+// Problems.hpp
+//
+// 1D test problems shared by the demo, bench and work_precision apps.
+#pragma once
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/Interval.hpp"
+#include "core/Function.hpp"
+
+#include "functions/Power.hpp"
+#include "functions/PolyX2Cos.hpp"
+#include "functions/InvSqrt.hpp"
+#include "functions/LogX.hpp"
+#include "functions/T2Transform.hpp"
+
+struct Problem {
+    std::string label;
+    std::shared_ptr<integ::Function> f;
+    integ::Interval I;
+    double exact;
+    bool exact_available;
+};
+
+/// The four 1D problems (singular integrands through x = t^2)
+inline std::vector<Problem> make_problems() {
+    using namespace integ;
+
+    std::vector<Problem> problems;
+    problems.push_back({"x^10", std::make_shared<Power>(10), Interval(0.0,1.0), 1.0/11.0, true});
+    problems.push_back({"x^2 cos(x)", std::make_shared<PolyX2Cos>(), Interval(0.0,1.0), 2.0*std::cos(1.0)-std::sin(1.0), true});
+    {
+        auto f_base = std::make_shared<InvSqrt>();
+        auto f_t2 = std::make_shared<T2Transform>(f_base, 2.0, "x^(-1/2) (x=t^2)");
+        problems.push_back({"x^(-1/2)", f_t2, Interval(0.0,1.0), 2.0, true});
+    }
+    {
+        auto f_base = std::make_shared<LogX>();
+        auto f_t2 = std::make_shared<T2Transform>(f_base, 0.0, "log(x) (x=t^2)");
+        problems.push_back({"log(x)", f_t2, Interval(0.0,1.0), -1.0, true});
+    }
+    return problems;
+}
@@ -0,0 +1,464 @@
+// bench.cpp
+//
+// Timing benchmark: every solver against every integrand over a sweep of
+// n / n_samples (tolerances for adaptive solvers, the order for single
+// Gauss–Legendre rules). Each case is run once to warm up, then --reps
+// times; the median and p99 wall times are reported with ns per
+// evaluation and evaluations per second, and the whole run is written as
+// JSON for regression tracking.
+//
+// Usage: bench [--reps N] [--threads N] [--filter TEXT] [--quick]
+//              [--output outputs/bench.json]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/Interval.hpp"
+#include "core/Domain2D.hpp"
+#include "core/Function.hpp"
+#include "core/Function2D.hpp"
+#include "core/Parallel.hpp"
+#include "core/Solver.hpp"
+
+#include "functions/ProductXY2D.hpp"
+#include "functions/SumSquaresXY2D.hpp"
+#include "functions/SinXY2D.hpp"
+#include "functions/ExpXY2D.hpp"
+
+#include "solvers/CompositeTrapezoid.hpp"
+#include "solvers/CompositeSimpson.hpp"
+#include "solvers/MonteCarloUniform.hpp"
+#include "solvers/QuasiMonteCarlo.hpp"
+#include "solvers/GaussLegendre.hpp"
+#include "solvers/GSLIntegrator.hpp"
+#include "solvers/AdaptiveGaussKronrod.hpp"
+#include "solvers/Romberg.hpp"
+#include "solvers/AutoSolver.hpp"
+#include "solvers/MonteCarlo2D.hpp"
+#include "solvers/NestedIntegral2D.hpp"
+#include "solvers/TensorProduct2D.hpp"
+#include "solvers/StaticGaussLegendre.hpp"
+#include "solvers/InlineSolvers.hpp"
+
+#include "AppUtils.hpp"
+#include "Problems.hpp"
+
+using namespace integ;
+
+// --- Command line ---
+static const char* const usage =
+    "Usage: bench [--reps N] [--threads N] [--filter TEXT] [--quick]\n"
+    "             [--output outputs/bench.json]\n";
+
+struct Options {
+    std::size_t reps = 10;
+    std::size_t threads = 1;
+    std::string filter;
+    bool quick = false;
+    std::string output = "outputs/bench.json";
+};
+
+static Options parse_options(int argc, char** argv) {
+    Options o;
+    parse_args(argc, argv, "bench",
+        [&o](const std::string& arg, const std::string& v) {
+            if (arg == "--reps") o.reps = std::max<std::size_t>(1, std::stoul(v));
+            else if (arg == "--threads") o.threads = std::stoul(v);
+            else if (arg == "--filter") o.filter = v;
+            else if (arg == "--output") o.output = v;
+            else return false;
+            return true;
+        },
+        [&o](const std::string& arg) {
+            if (arg != "--quick") return false;
+            o.quick = true;
+            return true;
+        });
+    return o;
+}
+
+// --- Benchmark cases ---
+struct Case {
+    std::string function;
+    std::string solver;
+    std::string param;   ///< Swept parameter ("n", "n_samples", "rel_tol")
+    double param_value;
+    double exact;
+    std::function<IntegrationResult()> run;
+};
+
+struct Measurement {
+    Case c;
+    bool success = false;
+    std::string error;
+    std::size_t evaluations = 0;
+    double abs_error = std::numeric_limits<double>::quiet_NaN();
+    double median_ns = 0.0;
+    double p99_ns = 0.0;
+    double min_ns = 0.0;
+    double mean_ns = 0.0;
+};
+
+/// Nearest-rank percentile of sorted samples
+static double percentile(const std::vector<double>& sorted, double q) {
+    const std::size_t n = sorted.size();
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(q * static_cast<double>(n)));
+    return sorted[std::min(n - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+static double median(const std::vector<double>& sorted) {
+    const std::size_t n = sorted.size();
+    return (n % 2 == 1) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+}
+
+static Measurement measure(const Case& c, std::size_t reps) {
+    Measurement m;
+    m.c = c;
+    try {
+        // Warm-up (rule caches, workspace pools, page faults)
+        const IntegrationResult r = c.run();
+        m.evaluations = r.evaluations;
+        m.abs_error = std::abs(r.value - c.exact);
+
+        std::vector<double> ns(reps);
+        for (std::size_t k = 0; k < reps; ++k) {
+            const auto t0 = std::chrono::steady_clock::now();
+            c.run();
+            const auto t1 = std::chrono::steady_clock::now();
+            ns[k] = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        }
+        std::sort(ns.begin(), ns.end());
+        m.median_ns = median(ns);
+        m.p99_ns = percentile(ns, 0.99);
+        m.min_ns = ns.front();
+        double sum = 0.0;
+        for (double t : ns) sum += t;
+        m.mean_ns = sum / static_cast<double>(reps);
+        m.success = true;
+    } catch (const std::exception& e) {
+        m.error = e.what();
+    }
+    return m;
+}
+
+// --- Output ---
+static std::string case_name(const Case& c) {
+    std::ostringstream oss;
+    oss << c.solver << "/" << c.function << "/" << c.param << ":" << c.param_value;
+    return oss.str();
+}
+
+static void write_json(const std::string& path, const Options& o,
+                       const std::vector<Measurement>& ms)
+{
+    std::ofstream out = open_output(path);
+
+    const std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"threads\": " << resolve_threads(o.threads) << ",\n"
+        << "    \"repetitions\": " << o.reps << "\n"
+        << "  },\n  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < ms.size(); ++i) {
+        const Measurement& m = ms[i];
+        const double s = m.median_ns * 1e-9;
+        const double evals = static_cast<double>(m.evaluations);
+        out << (i ? "," : "") << "\n    {"
+            << "\"name\": \"" << json_escape(case_name(m.c)) << "\", "
+            << "\"function\": \"" << json_escape(m.c.function) << "\", "
+            << "\"solver\": \"" << json_escape(m.c.solver) << "\", "
+            << "\"param\": \"" << m.c.param << "\", "
+            << "\"param_value\": " << json_number(m.c.param_value) << ", "
+            << "\"success\": " << (m.success ? "true" : "false") << ", ";
+        if (!m.success) {
+            out << "\"error_message\": \"" << json_escape(m.error) << "\"}";
+            continue;
+        }
+        out << "\"repetitions\": " << o.reps << ", "
+            << "\"evaluations\": " << m.evaluations << ", "
+            << "\"abs_error\": " << json_number(m.abs_error) << ", "
+            << "\"median_ns\": " << json_number(m.median_ns) << ", "
+            << "\"p99_ns\": " << json_number(m.p99_ns) << ", "
+            << "\"min_ns\": " << json_number(m.min_ns) << ", "
+            << "\"mean_ns\": " << json_number(m.mean_ns) << ", "
+            << "\"ns_per_eval\": " << json_number(evals > 0 ? m.median_ns / evals : NAN) << ", "
+            << "\"evals_per_second\": " << json_number(s > 0 ? evals / s : NAN) << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static void print_header() {
+    std::cout << std::left
+              << std::setw(42) << "Solver"
+              << std::setw(14) << "Function"
+              << std::setw(20) << "Param"
+              << std::right
+              << std::setw(12) << "Evals"
+              << std::setw(14) << "Median(us)"
+              << std::setw(14) << "p99(us)"
+              << std::setw(12) << "ns/eval"
+              << std::setw(14) << "Meval/s"
+              << std::setw(12) << "AbsError"
+              << "\n"
+              << std::string(42 + 14 + 20 + 12 + 14 + 14 + 12 + 14 + 12, '-') << "\n";
+}
+
+static void print_row(const Measurement& m) {
+    std::ostringstream param;
+    param << m.c.param << "=" << m.c.param_value;
+    std::cout << std::left
+              << std::setw(42) << m.c.solver
+              << std::setw(14) << m.c.function
+              << std::setw(20) << param.str()
+              << std::right;
+    if (!m.success) {
+        std::cout << "  FAILED: " << m.error << "\n";
+        return;
+    }
+    const double evals = static_cast<double>(m.evaluations);
+    std::cout << std::setw(12) << m.evaluations
+              << std::setw(14) << std::fixed << std::setprecision(2) << m.median_ns * 1e-3
+              << std::setw(14) << m.p99_ns * 1e-3
+              << std::setw(12) << (evals > 0 ? m.median_ns / evals : 0.0)
+              << std::setw(14) << (m.median_ns > 0 ? evals / m.median_ns * 1e3 : 0.0)
+              << std::setw(12) << std::scientific << std::setprecision(2) << m.abs_error
+              << std::defaultfloat << "\n";
+}
+
+/// One case per setting of a solver that lives as long as the cases
+static void add_cases(std::vector<Case>& cases, const Problem& pb,
+                      std::shared_ptr<const Solver> s, const std::string& param,
+                      const std::vector<SolverParams>& settings, const std::vector<double>& values)
+{
+    for (std::size_t k = 0; k < settings.size(); ++k) {
+        const SolverParams p = settings[k];
+        const Function& f = *pb.f;
+        const Interval I = pb.I;
+        cases.push_back({pb.label, s->name(), param, values[k], pb.exact,
+                         [s, &f, I, p] { return s->integrate(f, I, p); }});
+    }
+}
+
+/// Header-only kernels specialized for the concrete integrand type F
+template <class F>
+static void add_inline_cases(std::vector<Case>& cases, const Problem& pb,
+                             const SolverParams& base,
+                             const std::vector<std::size_t>& grid_n,
+                             const std::vector<std::size_t>& sample_n)
+{
+    std::vector<SolverParams> grid, samples;
+    std::vector<double> grid_v, samples_v;
+    for (std::size_t n : grid_n) {
+        grid.push_back(base);
+        grid.back().n = n;
+        grid_v.push_back(static_cast<double>(n));
+    }
+    for (std::size_t n : sample_n) {
+        samples.push_back(base);
+        samples.back().n_samples = n;
+        samples_v.push_back(static_cast<double>(n));
+    }
+    add_cases(cases, pb, std::make_shared<InlineSolver<F, kernels::Trapezoid>>(), "n", grid, grid_v);
+    add_cases(cases, pb, std::make_shared<InlineSolver<F, kernels::Simpson>>(), "n", grid, grid_v);
+    add_cases(cases, pb, std::make_shared<InlineSolver<F, kernels::GaussLegendre>>(
+                  kernels::GaussLegendre(5, true)), "n", grid, grid_v);
+    add_cases(cases, pb, std::make_shared<InlineSolver<F, kernels::MonteCarlo>>(),
+              "n_samples", samples, samples_v);
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    try {
+        opt = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        // Bad option or value (std::stoul throws too)
+        std::cerr << e.what() << "\n" << usage;
+        return 2;
+    }
+
+    // --- Integrands (same problems as the demo) ---
+    const std::vector<Problem> problems = make_problems();
+
+    struct Problem2D { std::string label; std::shared_ptr<Function2D> f; double exact; };
+    const Domain2D domain(Interval(0, 1), Interval(2, 3));
+    std::vector<Problem2D> problems2d = {
+        {"x*y", std::make_shared<ProductXY2D>(), 1.25},
+        {"x^2+y^2", std::make_shared<SumSquaresXY2D>(), 1.0 / 3.0 + 19.0 / 3.0},
+        {"sin(x+y)", std::make_shared<SinXY2D>(), -std::sin(4.0) + 2.0 * std::sin(3.0) - std::sin(2.0)},
+        {"exp(-x+y)", std::make_shared<ExpXY2D>(), std::exp(3.0) - 2.0 * std::exp(2.0) + std::exp(1.0)},
+    };
+
+    // --- Solvers ---
+    CompositeTrapezoidSolver trap;
+    CompositeSimpsonSolver simp;
+    GaussLegendreSolver gl5_composite(5, true);
+    StaticGaussLegendreSolver<5> static_gl5_composite(true);
+    MonteCarloUniformSolver mc;
+    QuasiMonteCarloSolver qmc;
+    GSLIntegrator gsl_solver;
+    AutoSolver auto_solver;
+    AdaptiveGaussKronrodSolver gk21;
+    RombergSolver romberg;
+    MonteCarlo2D mc2d;
+
+    // --- Sweeps ---
+    const std::vector<std::size_t> grid_n = opt.quick
+        ? std::vector<std::size_t>{100, 10000}
+        : std::vector<std::size_t>{100, 1000, 10000, 100000};
+    const std::vector<std::size_t> sample_n = opt.quick
+        ? std::vector<std::size_t>{1000, 100000}
+        : std::vector<std::size_t>{1000, 10000, 100000, 1000000};
+    const std::vector<double> tolerances = opt.quick
+        ? std::vector<double>{1e-6, 1e-10}
+        : std::vector<double>{1e-4, 1e-6, 1e-8, 1e-10};
+    const std::vector<std::size_t> gl_orders = opt.quick
+        ? std::vector<std::size_t>{5, 20}
+        : std::vector<std::size_t>{5, 20, 80};
+    const std::vector<std::size_t> grid_n2d = opt.quick
+        ? std::vector<std::size_t>{10, 100}
+        : std::vector<std::size_t>{10, 100, 1000};
+
+    SolverParams base;
+    base.n_threads = opt.threads;
+    base.seed = 42;
+
+    std::vector<Case> cases;
+
+    for (const auto& pb : problems) {
+        const Function& f = *pb.f;
+        const Interval I = pb.I;
+
+        for (Solver* s : std::vector<Solver*>{&trap, &simp, &gl5_composite, &static_gl5_composite}) {
+            for (std::size_t n : grid_n) {
+                SolverParams p = base;
+                p.n = n;
+                cases.push_back({pb.label, s->name(), "n", static_cast<double>(n), pb.exact,
+                                 [s, &f, I, p] { return s->integrate(f, I, p); }});
+            }
+        }
+        for (Solver* s : std::vector<Solver*>{&mc, &qmc}) {
+            for (std::size_t n : sample_n) {
+                SolverParams p = base;
+                p.n_samples = n;
+                cases.push_back({pb.label, s->name(), "n_samples", static_cast<double>(n), pb.exact,
+                                 [s, &f, I, p] { return s->integrate(f, I, p); }});
+            }
+        }
+        // Single Gauss–Legendre rule: the order is the parameter
+        for (std::size_t order : gl_orders) {
+            auto s = std::make_shared<GaussLegendreSolver>(order);
+            cases.push_back({pb.label, s->name(), "order", static_cast<double>(order), pb.exact,
+                             [s, &f, I, base] { return s->integrate(f, I, base); }});
+        }
+        {
+            const std::vector<std::shared_ptr<const Solver>> static_rules = {
+                std::make_shared<StaticGaussLegendreSolver<5>>(),
+                std::make_shared<StaticGaussLegendreSolver<20>>(),
+                std::make_shared<StaticGaussLegendreSolver<80>>(),
+            };
+            const std::size_t orders[] = {5, 20, 80};
+            for (std::size_t k = 0; k < static_rules.size(); ++k) {
+                if (opt.quick && orders[k] > 20) continue;
+                auto s = static_rules[k];
+                cases.push_back({pb.label, s->name(), "order", static_cast<double>(orders[k]), pb.exact,
+                                 [s, &f, I, base] { return s->integrate(f, I, base); }});
+            }
+        }
+        for (Solver* s : std::vector<Solver*>{&gk21, &romberg, &auto_solver}) {
+            for (double tol : tolerances) {
+                SolverParams p = base;
+                p.abs_tol = tol;
+                p.rel_tol = tol;
+                cases.push_back({pb.label, s->name(), "rel_tol", tol, pb.exact,
+                                 [s, &f, I, p] { return s->integrate(f, I, p); }});
+            }
+        }
+        // Every GSL routine (QAG with its default 21-point key)
+        const std::pair<GSLMethod, std::string> gsl_methods[] = {
+            {GSLMethod::QNG, "QNG"}, {GSLMethod::QAG, "QAG"},
+            {GSLMethod::QAGS, "QAGS"}, {GSLMethod::CQUAD, "CQUAD"},
+        };
+        for (const auto& [method, method_name] : gsl_methods) {
+            for (double tol : tolerances) {
+                SolverParams p = base;
+                p.abs_tol = tol;
+                p.rel_tol = tol;
+                p.gsl_method = method;
+                cases.push_back({pb.label, gsl_solver.name() + "(" + method_name + ")", "rel_tol", tol, pb.exact,
+                                 [&gsl_solver, &f, I, p] { return gsl_solver.integrate(f, I, p); }});
+            }
+        }
+
+        // Inline kernels on the concrete integrand type
+        const Function* fp = pb.f.get();
+        if (dynamic_cast<const Power*>(fp)) {
+            add_inline_cases<Power>(cases, pb, base, grid_n, sample_n);
+        } else if (dynamic_cast<const PolyX2Cos*>(fp)) {
+            add_inline_cases<PolyX2Cos>(cases, pb, base, grid_n, sample_n);
+        } else if (dynamic_cast<const T2Transform*>(fp)) {
+            add_inline_cases<T2Transform>(cases, pb, base, grid_n, sample_n);
+        }
+    }
+
+    // Same rectangle with std::function bounds: NestedIntegral2D runs its
+    // nested loop on it instead of handing the grid to TensorProduct2D
+    const Domain2D nested_domain(Interval(0, 1),
+                                 [](double) { return 2.0; },
+                                 [](double) { return 3.0; });
+
+    for (const auto& pb : problems2d) {
+        const Function2D& f = *pb.f;
+
+        for (Solver* s : std::vector<Solver*>{&trap, &simp, &gl5_composite}) {
+            for (std::size_t n : grid_n2d) {
+                SolverParams p = base;
+                p.n = n;
+                cases.push_back({pb.label, "Nested2D(" + s->name() + ")", "n", static_cast<double>(n), pb.exact,
+                                 [s, &f, &nested_domain, p] { return NestedIntegral2D(*s, *s).integrate(f, nested_domain, p); }});
+                cases.push_back({pb.label, "TensorProduct2D(" + s->name() + ")", "n", static_cast<double>(n), pb.exact,
+                                 [s, &f, &domain, p] { return TensorProduct2D(*s, *s).integrate(f, domain, p); }});
+            }
+        }
+        for (std::size_t n : sample_n) {
+            SolverParams p = base;
+            p.n_samples = n;
+            cases.push_back({pb.label, mc2d.name(), "n_samples", static_cast<double>(n), pb.exact,
+                             [&mc2d, &f, &domain, p] { return mc2d.integrate(f, domain, p); }});
+            cases.push_back({pb.label, qmc.name() + "2D", "n_samples", static_cast<double>(n), pb.exact,
+                             [&qmc, &f, &domain, p] { return qmc.integrate(f, domain, p); }});
+        }
+    }
+
+    // --- Run ---
+    std::vector<Measurement> results;
+    print_header();
+    for (const Case& c : cases) {
+        if (!opt.filter.empty() && case_name(c).find(opt.filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(measure(c, opt.reps));
+        print_row(results.back());
+    }
+
+    write_json(opt.output, opt, results);
+    std::cout << "\nJSON written to: " << opt.output << "\n";
+
+    return 0;
+}
@@ -16,11 +16,6 @@
 #include "core/Function2D.hpp"
 #include "core/Solver.hpp"
 
-#include "functions/Power.hpp"
-#include "functions/PolyX2Cos.hpp"
-#include "functions/InvSqrt.hpp"
-#include "functions/LogX.hpp"
-#include "functions/T2Transform.hpp"
 #include "functions/ProductXY2D.hpp"
 #include "functions/SumSquaresXY2D.hpp"
 #include "functions/SinXY2D.hpp"
@@ -31,16 +26,12 @@
 #include "solvers/MonteCarloUniform.hpp"
 #include "solvers/GaussLegendre.hpp"
 #include "solvers/GSLIntegrator.hpp"
+#include "solvers/AdaptiveGaussKronrod.hpp"
+#include "solvers/Romberg.hpp"
+#include "solvers/MonteCarlo2D.hpp"
 #include "solvers/NestedIntegral2D.hpp"
 
-
-struct Problem {
-    std::string label;
-    std::shared_ptr<integ::Function> f;
-    integ::Interval I;
-    double exact;
-    bool exact_available;
-};
+#include "Problems.hpp"
 
 struct CsvRow {
     std::string function;
@@ -143,7 +134,7 @@ static std::string domain_str(const integ::Domain2D& D, int n_samples=5) {
 
 static void print_row_safe(const std::string& func_label,
                            const std::string& interval_str,
-                           const integ::Solver& solver,
+                           const std::string& solver_name,
                            const integ::IntegrationResult& r,
                            double exact,
                            bool exact_available)
@@ -151,7 +142,7 @@ static void print_row_safe(const std::string& func_label,
     std::cout << std::left
               << std::setw(20) << func_label
               << std::setw(28) << interval_str
-              << std::setw(24) << solver.name()
+              << std::setw(24) << solver_name
               << std::right;
 
     if (r.success) {
@@ -178,28 +169,18 @@ int main(int argc, char** argv) {
 
     std::cout << std::setprecision(15);
 
-    std::vector<Problem> problems;
-
     // --- 1D problems ---
-    problems.push_back({"x^10", std::make_shared<Power>(10), Interval(0.0,1.0), 1.0/11.0, true});
-    problems.push_back({"x^2 cos(x)", std::make_shared<PolyX2Cos>(), Interval(0.0,1.0), 2.0*std::cos(1.0)-std::sin(1.0), true});
-    {
-        auto f_base = std::make_shared<InvSqrt>();
-        auto f_t2 = std::make_shared<T2Transform>(f_base, 2.0, "x^(-1/2) (x=t^2)");
-        problems.push_back({"x^(-1/2)", f_t2, Interval(0.0,1.0), 2.0, true});
-    }
-    {
-        auto f_base = std::make_shared<LogX>();
-        auto f_t2 = std::make_shared<T2Transform>(f_base, 0.0, "log(x) (x=t^2)");
-        problems.push_back({"log(x)", f_t2, Interval(0.0,1.0), -1.0, true});
-    }
+    const std::vector<Problem> problems = make_problems();
 
     // --- 1D Solvers ---
     CompositeTrapezoidSolver trap;
     CompositeSimpsonSolver simp;
     MonteCarloUniformSolver mc;
     GaussLegendreSolver gl5(5);
+    GaussLegendreSolver gl5_composite(5, true);
     GSLIntegrator gsl_solver;
+    AdaptiveGaussKronrodSolver gk21;
+    RombergSolver romberg;
 
     // --- 1D Integration Demo ---
     std::cout << "\n\n##### 1D Integration Demo #####\n\n";
@@ -214,12 +195,11 @@ int main(int argc, char** argv) {
             integ::IntegrationResult r;
             try {
                 r = solver.integrate(*pb.f, pb.I, params);
-                r.success = true;
             } catch (...) {
                 r = integ::IntegrationResult{};
                 r.success = false;
             }
-            print_row_safe(pb.label, interval_str(pb.I), solver, r, pb.exact, pb.exact_available);
+            print_row_safe(pb.label, interval_str(pb.I), solver.name(), r, pb.exact, pb.exact_available);
 
             rows.push_back({pb.label, interval_str(pb.I), solver.name(), r.value, pb.exact,
                             pb.exact_available, r.success ? std::abs(r.value - pb.exact) : std::numeric_limits<double>::quiet_NaN(),
@@ -229,10 +209,13 @@ int main(int argc, char** argv) {
         run_solver_safe(trap, p);
         run_solver_safe(simp, p);
         run_solver_safe(gl5, p);
+        run_solver_safe(gl5_composite, p);
 
         p.n_samples = 200000; p.seed = 42; p.compute_error_estimate = true;
         run_solver_safe(mc, p);
         run_solver_safe(gsl_solver, p);
+        run_solver_safe(gk21, p);
+        run_solver_safe(romberg, p);
 
         std::cout << "\n";
     }
@@ -249,11 +232,7 @@ int main(int argc, char** argv) {
         {"exp(-x+y)", std::make_shared<ExpXY2D>(), std::exp(3.0) - 2.0*std::exp(2.0) + std::exp(1.0)}
     };
 
-    Domain2D domain2d(
-        Interval(0,1),
-        [](double){ return 2.0; },
-        [](double){ return 3.0; }
-    );
+    Domain2D domain2d(Interval(0,1), Interval(2,3));
 
     std::vector<std::pair<std::shared_ptr<Solver>, std::shared_ptr<Solver>>> solver_pairs = {
         {std::make_shared<CompositeTrapezoidSolver>(), std::make_shared<CompositeTrapezoidSolver>()},
@@ -272,17 +251,36 @@ int main(int argc, char** argv) {
             integ::IntegrationResult r2d;
             try {
                 r2d = nested.integrate(*f2d, domain2d, p2d);
-                r2d.success = true;
             } catch (...) {
                 r2d = integ::IntegrationResult{};
                 r2d.success = false;
             }
 
-            print_row_safe(label, domain_str(domain2d), *outer, r2d, exact, true);  
+            print_row_safe(label, domain_str(domain2d), outer->name(), r2d, exact, true);
             rows2D.push_back({label, domain_str(domain2d), outer->name(), r2d.value, exact, true,
                               r2d.success ? std::abs(r2d.value - exact) : std::numeric_limits<double>::quiet_NaN(),
                               r2d.evaluations, r2d.has_error_estimate, r2d.error_estimate});
         }
+
+        // Monte Carlo sampled directly in the domain (not nested)
+        {
+            MonteCarlo2D mc2d;
+            SolverParams p2d;
+            p2d.n_samples = 200000; p2d.seed = 42; p2d.compute_error_estimate = true;
+
+            integ::IntegrationResult r2d;
+            try {
+                r2d = mc2d.integrate(*f2d, domain2d, p2d);
+            } catch (...) {
+                r2d = integ::IntegrationResult{};
+                r2d.success = false;
+            }
+
+            print_row_safe(label, domain_str(domain2d), mc2d.name(), r2d, exact, true);
+            rows2D.push_back({label, domain_str(domain2d), mc2d.name(), r2d.value, exact, true,
+                              r2d.success ? std::abs(r2d.value - exact) : std::numeric_limits<double>::quiet_NaN(),
+                              r2d.evaluations, r2d.has_error_estimate, r2d.error_estimate});
+        }
         std::cout << "\n";
     }
 
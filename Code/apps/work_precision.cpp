@@ -0,0 +1,269 @@
+// work_precision.cpp
+//
+// Work–precision data: for every Problem, sweeps the accuracy knob of each
+// solver (n, n_samples, Gauss–Legendre order or tolerance), records the
+// median wall time, evaluations and achieved error, and marks the points
+// on the Pareto front (no other run is both faster and more accurate).
+// Also prints, for a few target accuracies, the fastest run reaching them.
+//
+// Usage: work_precision [--reps N] [--threads N] [--quick]
+//                       [--output outputs/work_precision.csv]
+//                       [--json outputs/work_precision.json]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/Solver.hpp"
+
+#include "solvers/CompositeTrapezoid.hpp"
+#include "solvers/CompositeSimpson.hpp"
+#include "solvers/MonteCarloUniform.hpp"
+#include "solvers/QuasiMonteCarlo.hpp"
+#include "solvers/GaussLegendre.hpp"
+#include "solvers/GSLIntegrator.hpp"
+#include "solvers/AdaptiveGaussKronrod.hpp"
+#include "solvers/Romberg.hpp"
+
+#include "AppUtils.hpp"
+#include "Problems.hpp"
+
+using namespace integ;
+
+// --- Command line ---
+static const char* const usage =
+    "Usage: work_precision [--reps N] [--threads N] [--quick]\n"
+    "                      [--output outputs/work_precision.csv]\n"
+    "                      [--json outputs/work_precision.json]\n";
+
+struct Options {
+    std::size_t reps = 5;
+    std::size_t threads = 1;
+    bool quick = false;
+    std::string csv = "outputs/work_precision.csv";
+    std::string json = "outputs/work_precision.json";
+};
+
+static Options parse_options(int argc, char** argv) {
+    Options o;
+    parse_args(argc, argv, "work_precision",
+        [&o](const std::string& arg, const std::string& v) {
+            if (arg == "--reps") o.reps = std::max<std::size_t>(1, std::stoul(v));
+            else if (arg == "--threads") o.threads = std::stoul(v);
+            else if (arg == "--output") o.csv = v;
+            else if (arg == "--json") o.json = v;
+            else return false;
+            return true;
+        },
+        [&o](const std::string& arg) {
+            if (arg != "--quick") return false;
+            o.quick = true;
+            return true;
+        });
+    return o;
+}
+
+// --- Sweeps ---
+
+/// One setting of a solver's accuracy knob
+struct Setting {
+    std::string solver;
+    std::string knob;                  ///< "n", "n_samples", "order" or "tol"
+    double knob_value;
+    std::shared_ptr<const Solver> s;   ///< Solver instance for this setting
+    SolverParams p;
+};
+
+/// One measured run
+struct Point {
+    std::string solver;
+    std::string knob;
+    double knob_value;
+    std::size_t evaluations;
+    double time_s;       ///< Median wall time
+    double abs_error;
+    bool pareto = false;
+};
+
+static std::vector<Setting> make_settings(const Options& opt) {
+    SolverParams base;
+    base.n_threads = opt.threads;
+    base.seed = 42;
+
+    const int max_pow2 = opt.quick ? 14 : 20;
+    const int max_pow10 = opt.quick ? 5 : 7;
+
+    std::vector<Setting> out;
+
+    auto trap = std::make_shared<CompositeTrapezoidSolver>();
+    auto simp = std::make_shared<CompositeSimpsonSolver>();
+    auto gl5c = std::make_shared<GaussLegendreSolver>(5, true);
+    for (int k = 1; k <= max_pow2; ++k) {
+        SolverParams p = base;
+        p.n = std::size_t{1} << k;
+        out.push_back({trap->name(), "n", static_cast<double>(p.n), trap, p});
+        out.push_back({simp->name(), "n", static_cast<double>(p.n), simp, p});
+        if (k <= max_pow2 - 3) {
+            out.push_back({gl5c->name(), "n", static_cast<double>(p.n), gl5c, p});
+        }
+    }
+
+    // Single-panel Gauss–Legendre: the order is the knob
+    for (std::size_t m = 2; m <= (opt.quick ? 64u : 512u); m *= 2) {
+        auto gl = std::make_shared<GaussLegendreSolver>(m);
+        out.push_back({"GaussLegendre", "order", static_cast<double>(m), gl, base});
+    }
+
+    auto mc = std::make_shared<MonteCarloUniformSolver>();
+    auto qmc = std::make_shared<QuasiMonteCarloSolver>();
+    for (int k = 2; k <= max_pow10; ++k) {
+        SolverParams p = base;
+        p.n_samples = static_cast<std::size_t>(std::pow(10.0, k));
+        out.push_back({mc->name(), "n_samples", static_cast<double>(p.n_samples), mc, p});
+        out.push_back({qmc->name(), "n_samples", static_cast<double>(p.n_samples), qmc, p});
+    }
+
+    auto gsl = std::make_shared<GSLIntegrator>();
+    auto gk21 = std::make_shared<AdaptiveGaussKronrodSolver>();
+    auto romberg = std::make_shared<RombergSolver>();
+    for (int k = 2; k <= 14; k += (opt.quick ? 4 : 2)) {
+        SolverParams p = base;
+        p.abs_tol = std::pow(10.0, -k);
+        p.rel_tol = p.abs_tol;
+        out.push_back({gsl->name(), "tol", p.abs_tol, gsl, p});
+        out.push_back({gk21->name(), "tol", p.abs_tol, gk21, p});
+        out.push_back({romberg->name(), "tol", p.abs_tol, romberg, p});
+    }
+
+    return out;
+}
+
+/// Median wall time of reps runs (after one warm-up run); false for
+/// runs that throw or report success == false (e.g. GSL not converged)
+static bool run_setting(const Problem& pb, const Setting& st, std::size_t reps, Point& pt) {
+    try {
+        const IntegrationResult r = st.s->integrate(*pb.f, pb.I, st.p);
+        if (!r.success) return false;
+        std::vector<double> times(reps);
+        for (std::size_t k = 0; k < reps; ++k) {
+            const auto t0 = std::chrono::steady_clock::now();
+            st.s->integrate(*pb.f, pb.I, st.p);
+            times[k] = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        }
+        std::sort(times.begin(), times.end());
+        pt = {st.solver, st.knob, st.knob_value, r.evaluations, times[reps / 2],
+              std::abs(r.value - pb.exact)};
+        return std::isfinite(pt.abs_error);
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/// Mark points not dominated in (time, error) by any other point
+static void mark_pareto(std::vector<Point>& pts) {
+    for (auto& a : pts) {
+        a.pareto = std::none_of(pts.begin(), pts.end(), [&](const Point& b) {
+            return b.time_s <= a.time_s && b.abs_error <= a.abs_error &&
+                   (b.time_s < a.time_s || b.abs_error < a.abs_error);
+        });
+    }
+}
+
+// --- Output ---
+static void write_point_json(std::ostream& out, const Point& pt) {
+    out << "{\"solver\": \"" << json_escape(pt.solver) << "\", "
+        << "\"knob\": \"" << pt.knob << "\", "
+        << "\"knob_value\": " << json_number(pt.knob_value) << ", "
+        << "\"evaluations\": " << pt.evaluations << ", "
+        << "\"time_s\": " << json_number(pt.time_s) << ", "
+        << "\"abs_error\": " << json_number(pt.abs_error) << "}";
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    try {
+        opt = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        // Bad option or value (std::stoul throws too)
+        std::cerr << e.what() << "\n" << usage;
+        return 2;
+    }
+    const std::vector<Problem> problems = make_problems();
+    const std::vector<Setting> settings = make_settings(opt);
+    const double targets[] = {1e-4, 1e-8, 1e-12};
+
+    std::ofstream csv = open_output(opt.csv);
+    csv << "Problem,Solver,Knob,KnobValue,Evals,TimeS,AbsError,Pareto\n";
+
+    std::ofstream json = open_output(opt.json);
+    json << "{\n  \"problems\": [";
+    bool first_problem = true;
+
+    for (std::size_t ip = 0; ip < problems.size(); ++ip) {
+        const Problem& pb = problems[ip];
+        if (!pb.exact_available) continue;
+
+        std::vector<Point> pts;
+        for (const Setting& st : settings) {
+            Point pt;
+            if (run_setting(pb, st, opt.reps, pt)) pts.push_back(pt);
+        }
+        mark_pareto(pts);
+        std::sort(pts.begin(), pts.end(),
+                  [](const Point& a, const Point& b) { return a.time_s < b.time_s; });
+
+        for (const Point& pt : pts) {
+            csv << csv_escape(pb.label) << "," << csv_escape(pt.solver) << ","
+                << pt.knob << "," << pt.knob_value << "," << pt.evaluations << ","
+                << pt.time_s << "," << pt.abs_error << "," << (pt.pareto ? 1 : 0) << "\n";
+        }
+
+        json << (first_problem ? "" : ",") << "\n    {\"label\": \"" << json_escape(pb.label) << "\", "
+             << "\"exact\": " << json_number(pb.exact) << ",\n     \"points\": [";
+        for (std::size_t k = 0; k < pts.size(); ++k) {
+            json << (k ? ",\n       " : "\n       ");
+            write_point_json(json, pts[k]);
+        }
+        json << "],\n     \"pareto_front\": [";
+        bool first = true;
+        for (const Point& pt : pts) {
+            if (!pt.pareto) continue;
+            json << (first ? "\n       " : ",\n       ");
+            write_point_json(json, pt);
+            first = false;
+        }
+        json << "]}";
+        first_problem = false;
+
+        // Fastest run reaching each target accuracy
+        std::cout << "\n##### " << pb.label << " #####\n";
+        for (double tol : targets) {
+            const auto it = std::find_if(pts.begin(), pts.end(),
+                [tol](const Point& pt) { return pt.abs_error <= tol; });
+            std::cout << "  error <= " << std::setw(6) << tol << " : ";
+            if (it == pts.end()) {
+                std::cout << "not reached\n";
+                continue;
+            }
+            std::cout << std::left << std::setw(34) << it->solver << std::right
+                      << it->knob << "=" << it->knob_value
+                      << "  " << it->evaluations << " evals, "
+                      << it->time_s * 1e6 << " us\n";
+        }
+    }
+
+    json << "\n  ]\n}\n";
+
+    std::cout << "\nCSV written to: " << opt.csv
+              << "\nJSON written to: " << opt.json << "\n";
+    return 0;
+}
@@ -0,0 +1,61 @@
+// CallableFunction.hpp
+#pragma once
+#include <string>
+#include <utility>
+#include "core/Function.hpp"
+
+namespace integ {
+
+/**
+ * @brief Adapts any callable double(double) to the Function interface.
+ *
+ * The callable is stored by value and its type is known inside
+ * evaluate(), so the batch loop calls it directly (inlinable) and only
+ * the batch call itself is virtual.
+ *
+ * @tparam F Callable type with `double operator()(double) const`
+ */
+template <class F>
+class CallableFunction final : public Function {
+public:
+    /**
+     * @brief Wrap a callable
+     * @param f Callable
+     * @param name Optional name for logging/printing
+     */
+    explicit CallableFunction(F f, std::string name = "CallableFunction")
+        : f_(std::move(f)), name_(std::move(name))
+    {}
+
+    /** @brief Evaluate the callable at x */
+    double operator()(double x) const override {
+        return f_(x);
+    }
+
+    /** @brief Evaluate the callable at n points without virtual calls */
+    void evaluate(const double* x, double* y, std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = f_(x[i]);
+        }
+    }
+
+    /** @brief Return the function name */
+    std::string name() const override { return name_; }
+
+    /** @brief Access the wrapped callable */
+    const F& callable() const { return f_; }
+
+private:
+    F f_;
+    std::string name_;
+};
+
+/**
+ * @brief Wrap a callable into a CallableFunction (type deduced)
+ */
+template <class F>
+CallableFunction<F> make_function(F f, std::string name = "CallableFunction") {
+    return CallableFunction<F>(std::move(f), std::move(name));
+}
+
+} // namespace integ
@@ -1,15 +1,28 @@
 // Domain2D.hpp
 #pragma once
 #include <functional>
+#include <utility>
 #include "Interval.hpp"
 
 namespace integ {
 
+/**
+ * @brief Affine bound y = intercept + slope * x.
+ */
+struct AffineBound {
+    double intercept = 0.0; ///< Value at x = 0
+    double slope = 0.0;     ///< dy/dx
+};
+
 /**
  * @brief Represents a 2D domain for integration.
  * 
  * The domain is defined by an interval in x and functions
  * that give the minimum and maximum y-values for each x.
+ *
+ * Constant and affine bounds (rectangles, triangles, trapezoids) are
+ * stored as plain coefficients and evaluated inline; only bounds given
+ * as arbitrary functions go through std::function.
  */
 class Domain2D {
 public:
@@ -25,19 +38,101 @@ public:
         std::function<double(double)> y_max
     );
 
+    /**
+     * @brief Construct a rectangular domain x_interval × y_interval.
+     * @param x_interval Interval for the x-axis.
+     * @param y_interval Interval for the y-axis.
+     */
+    Domain2D(Interval x_interval, Interval y_interval);
+
+    /**
+     * @brief Construct a domain with affine bounds.
+     * @param x_interval Interval for the x-axis.
+     * @param y_min Lower bound intercept + slope * x.
+     * @param y_max Upper bound intercept + slope * x.
+     */
+    Domain2D(Interval x_interval, AffineBound y_min, AffineBound y_max);
+
     /// @brief Get the x-interval.
-    const Interval& x_interval() const;
+    const Interval& x_interval() const { return x_; }
 
     /// @brief Get the minimum y for a given x.
-    double y_min(double x) const;
+    double y_min(double x) const {
+        return lo_.general ? lo_.f(x) : lo_.c0 + lo_.c1 * x;
+    }
 
     /// @brief Get the maximum y for a given x.
-    double y_max(double x) const;
+    double y_max(double x) const {
+        return hi_.general ? hi_.f(x) : hi_.c0 + hi_.c1 * x;
+    }
+
+    /// @brief True if both y bounds are constant.
+    bool is_rectangle() const;
+
+    /// @brief True if both y bounds are affine (constant included).
+    bool is_affine() const;
 
 private:
+    /// One y bound: coefficients, or a general function
+    struct Bound {
+        double c0 = 0.0;                 ///< Intercept (non-general)
+        double c1 = 0.0;                 ///< Slope (non-general)
+        bool general = false;            ///< True if f must be called
+        std::function<double(double)> f; ///< General bound
+    };
+
     Interval x_;
-    std::function<double(double)> y_min_;
-    std::function<double(double)> y_max_;
+    Bound lo_;
+    Bound hi_;
 };
 
-} // namespace integ
\ No newline at end of file
+/**
+ * @brief 2D domain whose y bounds are arbitrary callables of known type.
+ *
+ * Same interface as Domain2D (x_interval, y_min, y_max) without type
+ * erasure, so bound evaluation inlines; use it with the templated
+ * kernels (e.g. kernels::nested).
+ *
+ * @tparam YMin Callable double(double)
+ * @tparam YMax Callable double(double)
+ */
+template <class YMin, class YMax>
+class BasicDomain2D {
+public:
+    /**
+     * @brief Construct the domain
+     * @param x_interval Interval for the x-axis
+     * @param y_min Lower bound callable
+     * @param y_max Upper bound callable
+     */
+    BasicDomain2D(Interval x_interval, YMin y_min, YMax y_max)
+        : x_(x_interval), y_min_(std::move(y_min)), y_max_(std::move(y_max))
+    {}
+
+    /// @brief Get the x-interval.
+    const Interval& x_interval() const { return x_; }
+
+    /// @brief Get the minimum y for a given x.
+    double y_min(double x) const { return y_min_(x); }
+
+    /// @brief Get the maximum y for a given x.
+    double y_max(double x) const { return y_max_(x); }
+
+    /// @brief Convert to a (type-erased) Domain2D
+    Domain2D to_domain() const { return Domain2D(x_, y_min_, y_max_); }
+
+private:
+    Interval x_;
+    YMin y_min_;
+    YMax y_max_;
+};
+
+/**
+ * @brief Build a BasicDomain2D with deduced bound types
+ */
+template <class YMin, class YMax>
+BasicDomain2D<YMin, YMax> make_domain(Interval x_interval, YMin y_min, YMax y_max) {
+    return BasicDomain2D<YMin, YMax>(x_interval, std::move(y_min), std::move(y_max));
+}
+
+} // namespace integ
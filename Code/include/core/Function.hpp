@@ -1,9 +1,13 @@
 // Function.hpp
 #pragma once
+#include <cstddef>
 #include <string>
 
 namespace integ {
 
+/// Number of abscissae solvers hand to Function::evaluate in one call
+inline constexpr std::size_t batch_size = 256;
+
 /**
  * @brief Abstract base class for 1D functions.
  * 
@@ -21,6 +25,22 @@ public:
      */
     virtual double operator()(double x) const = 0;
 
+    /**
+     * @brief Evaluate the function at n abscissae.
+     *
+     * The default loops over operator(); derived classes override it
+     * with a non-virtual loop the compiler can inline and vectorize.
+     *
+     * @param x Input values (n entries).
+     * @param y Output values f(x[i]) (n entries).
+     * @param n Number of points.
+     */
+    virtual void evaluate(const double* x, double* y, std::size_t n) const {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = (*this)(x[i]);
+        }
+    }
+
     /**
      * @brief Optional function name (for logging or display).
      * @return Name of the function.
@@ -1,5 +1,6 @@
 // Function2D.hpp
 #pragma once
+#include <cstddef>
 
 namespace integ {
 
@@ -19,6 +20,42 @@ public:
      * @return Function value f(x, y).
      */
     virtual double operator()(double x, double y) const = 0;
+
+    /**
+     * @brief Evaluate the function at n points given as SoA arrays.
+     *
+     * The default loops over operator(); derived classes may override
+     * it with a non-virtual loop.
+     *
+     * @param x x-coordinates (n entries)
+     * @param y y-coordinates (n entries)
+     * @param out Output values f(x[i], y[i]) (n entries)
+     * @param n Number of points
+     */
+    virtual void evaluate(const double* x, const double* y, double* out,
+                          std::size_t n) const {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(x[i], y[i]);
+        }
+    }
+
+    /**
+     * @brief Evaluate the function at n points sharing the same x.
+     *
+     * This is the shape of the inner loop of a nested integral. The
+     * default loops over operator().
+     *
+     * @param x Fixed x-coordinate
+     * @param y y-coordinates (n entries)
+     * @param out Output values f(x, y[i]) (n entries)
+     * @param n Number of points
+     */
+    virtual void evaluate_y(double x, const double* y, double* out,
+                            std::size_t n) const {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(x, y[i]);
+        }
+    }
 };
 
 } // namespace integ
\ No newline at end of file
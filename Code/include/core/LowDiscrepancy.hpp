@@ -0,0 +1,103 @@
+// LowDiscrepancy.hpp
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace integ {
+
+/**
+ * @brief Two-dimensional Sobol sequence (32-bit, Gray-code order).
+ *
+ * Dimension 0 uses the van der Corput direction numbers v_k = 2^(31-k);
+ * dimension 1 uses the primitive polynomial x + 1 with m_1 = 1, i.e.
+ * v_k = v_{k-1} ^ (v_{k-1} >> 1). Point i is the XOR of the direction
+ * numbers selected by the bits of gray(i) = i ^ (i >> 1), so any index
+ * range can be generated independently: the first point of a block is
+ * computed directly, the next ones with one XOR each (Antonov–Saleev).
+ */
+class Sobol2D {
+public:
+    /// Number of bits per coordinate (indices must be < 2^bits)
+    static constexpr unsigned bits = 32;
+
+    Sobol2D() {
+        for (unsigned k = 0; k < bits; ++k) {
+            v0_[k] = std::uint32_t{1} << (bits - 1 - k);
+            v1_[k] = (k == 0) ? v0_[0] : (v1_[k - 1] ^ (v1_[k - 1] >> 1));
+        }
+    }
+
+    /**
+     * @brief Integer coordinates of points first..first+n-1
+     * @param first Index of the first point (first + n <= 2^32)
+     * @param n Number of points
+     * @param x0 Output, dimension 0
+     * @param x1 Output, dimension 1 (may be null)
+     */
+    void fill(std::uint64_t first, std::size_t n,
+              std::uint32_t* x0, std::uint32_t* x1) const
+    {
+        if (n == 0) return;
+
+        // Direct computation for the first point
+        const std::uint64_t g = first ^ (first >> 1);
+        std::uint32_t a = 0, b = 0;
+        for (unsigned k = 0; k < bits; ++k) {
+            if ((g >> k) & 1u) {
+                a ^= v0_[k];
+                b ^= v1_[k];
+            }
+        }
+
+        // Gray-code stepping: point i+1 flips the lowest zero bit of i
+        for (std::size_t j = 0; j < n; ++j) {
+            x0[j] = a;
+            if (x1) x1[j] = b;
+            const std::uint64_t i = first + j + 1;
+            const unsigned c = ctz(i);
+            if (c < bits) {
+                a ^= v0_[c];
+                b ^= v1_[c];
+            }
+        }
+    }
+
+private:
+    /// Number of trailing zero bits of i (i > 0)
+    static unsigned ctz(std::uint64_t i) {
+        unsigned c = 0;
+        while ((i & 1u) == 0) {
+            i >>= 1;
+            ++c;
+        }
+        return c;
+    }
+
+    std::array<std::uint32_t, bits> v0_; ///< Direction numbers, dimension 0
+    std::array<std::uint32_t, bits> v1_; ///< Direction numbers, dimension 1
+};
+
+/**
+ * @brief Radical inverse of i in the given base (Halton coordinate).
+ *
+ * Mirrors the base-b digits of i about the radix point:
+ * i = sum d_k b^k  ->  sum d_k b^{-k-1}.
+ *
+ * @param base Integer base (>= 2)
+ * @param i Index
+ * @return Value in [0, 1)
+ */
+inline double radical_inverse(unsigned base, std::uint64_t i) {
+    const double inv = 1.0 / static_cast<double>(base);
+    double f = inv;
+    double r = 0.0;
+    while (i > 0) {
+        r += f * static_cast<double>(i % base);
+        i /= base;
+        f *= inv;
+    }
+    return r;
+}
+
+} // namespace integ
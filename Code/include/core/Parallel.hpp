@@ -0,0 +1,136 @@
+// Parallel.hpp
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace integ {
+
+/// Number of indices per chunk in chunked_sum (independent of the thread count)
+inline constexpr std::size_t reduction_chunk = 16384;
+
+/**
+ * @brief Resolve a requested thread count.
+ * @param requested Requested number of threads (0 = hardware concurrency)
+ * @return Number of threads to use (always >= 1)
+ */
+std::size_t resolve_threads(std::size_t requested);
+
+/**
+ * @brief Number of threads parallel_for runs for n_tasks tasks.
+ * @param n_tasks Number of tasks
+ * @param n_threads Requested number of threads (0 = hardware concurrency)
+ * @return min(resolve_threads(n_threads), n_tasks), at least 1
+ */
+std::size_t threads_used(std::size_t n_tasks, std::size_t n_threads);
+
+/**
+ * @brief Number of threads chunked_sum / chunked_sums run over [0, n).
+ */
+inline std::size_t chunked_threads(
+    std::size_t n,
+    std::size_t n_threads,
+    std::size_t chunk = reduction_chunk
+)
+{
+    return threads_used((n + chunk - 1) / chunk, n_threads);
+}
+
+/**
+ * @brief Run task(i) for every i in [0, n_tasks) on up to n_threads threads.
+ *
+ * Tasks are handed out one at a time through a shared counter, so threads
+ * that finish early pick up the remaining work. With a single thread (or a
+ * single task) everything runs on the calling thread.
+ *
+ * @param n_tasks Number of tasks
+ * @param n_threads Number of threads (0 = hardware concurrency)
+ * @param task Callable invoked with the task index
+ * @throws Rethrows the first exception raised by a task
+ */
+void parallel_for(
+    std::size_t n_tasks,
+    std::size_t n_threads,
+    const std::function<void(std::size_t)>& task
+);
+
+/**
+ * @brief Sum n values by recursive pairwise splitting.
+ *
+ * The association order depends only on n, so the result is reproducible,
+ * and the rounding error grows as O(log n) instead of O(n).
+ *
+ * @param v Values to sum
+ * @param n Number of values
+ * @return Sum of v[0..n)
+ */
+double pairwise_sum(const double* v, std::size_t n);
+
+/**
+ * @brief Deterministic parallel sum over the index range [0, n).
+ *
+ * The range is cut into chunks of `chunk` indices, whatever the thread
+ * count; partial(begin, end) returns the contribution of one chunk and the
+ * chunk partials are combined with pairwise_sum. The result is therefore
+ * bit-identical for every value of n_threads.
+ *
+ * @param n Number of indices
+ * @param n_threads Number of threads (0 = hardware concurrency)
+ * @param partial Callable returning the sum over [begin, end)
+ * @param chunk Number of indices per chunk
+ * @return Total sum
+ */
+double chunked_sum(
+    std::size_t n,
+    std::size_t n_threads,
+    const std::function<double(std::size_t, std::size_t)>& partial,
+    std::size_t chunk = reduction_chunk
+);
+
+/**
+ * @brief chunked_sum with K independent accumulators.
+ *
+ * partial(begin, end) returns the K partial sums of one chunk; each
+ * component is reduced pairwise over the chunks, so every component is
+ * bit-identical for every value of n_threads.
+ *
+ * @tparam K Number of accumulators
+ * @param n Number of indices
+ * @param n_threads Number of threads (0 = hardware concurrency)
+ * @param partial Callable returning std::array<double, K> over [begin, end)
+ * @param chunk Number of indices per chunk
+ * @return The K totals
+ */
+template <std::size_t K, class Partial>
+std::array<double, K> chunked_sums(
+    std::size_t n,
+    std::size_t n_threads,
+    const Partial& partial,
+    std::size_t chunk = reduction_chunk
+)
+{
+    std::array<double, K> total{};
+    if (n == 0) return total;
+
+    const std::size_t n_chunks = (n + chunk - 1) / chunk;
+    std::vector<std::array<double, K>> partials(n_chunks);
+
+    parallel_for(n_chunks, n_threads, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t end = std::min(n, begin + chunk);
+        partials[c] = partial(begin, end);
+    });
+
+    std::vector<double> column(n_chunks);
+    for (std::size_t k = 0; k < K; ++k) {
+        for (std::size_t c = 0; c < n_chunks; ++c) {
+            column[c] = partials[c][k];
+        }
+        total[k] = pairwise_sum(column.data(), n_chunks);
+    }
+    return total;
+}
+
+} // namespace integ
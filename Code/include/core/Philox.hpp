@@ -0,0 +1,124 @@
+// Philox.hpp
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace integ {
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Maps a 128-bit counter and a 64-bit key to 128 random bits with no
+ * internal state (Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", SC'11). Sample i of stream s depends only on (key, i, s),
+ * so any index range can be generated independently on any thread and
+ * the sequence is the same whatever the partitioning.
+ */
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+
+    /**
+     * @brief Construct the generator from a seed
+     * @param seed Seed, spread over the 64-bit key
+     */
+    explicit Philox4x32(std::uint64_t seed) {
+        const std::uint64_t k = splitmix64(seed);
+        key_[0] = static_cast<std::uint32_t>(k);
+        key_[1] = static_cast<std::uint32_t>(k >> 32);
+    }
+
+    /**
+     * @brief Apply the 10-round bijection to a counter
+     * @param ctr Counter block
+     * @return 128 random bits
+     */
+    Counter operator()(Counter ctr) const {
+        std::uint32_t k0 = key_[0];
+        std::uint32_t k1 = key_[1];
+        for (int r = 0; r < 10; ++r) {
+            const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * ctr[0];
+            const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * ctr[2];
+            ctr = {
+                static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ k0,
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ k1,
+                static_cast<std::uint32_t>(p0)
+            };
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return ctr;
+    }
+
+    /**
+     * @brief Fill out[0..n) with uniforms U[0,1) number first..first+n-1 of a stream
+     *
+     * Each counter block yields two 53-bit doubles, so sample i comes
+     * from block i / 2 of the stream.
+     *
+     * @param first Index of the first sample
+     * @param out Output buffer
+     * @param n Number of samples
+     * @param stream Stream identifier (independent sequences)
+     */
+    void fill_uniform(std::uint64_t first, double* out, std::size_t n,
+                      std::uint32_t stream = 0) const
+    {
+        std::size_t k = 0;
+        std::uint64_t i = first;
+        while (k < n) {
+            const std::uint64_t block = i >> 1;
+            const Counter r = (*this)({
+                static_cast<std::uint32_t>(block),
+                static_cast<std::uint32_t>(block >> 32),
+                stream,
+                0u
+            });
+            if ((i & 1u) == 0) {
+                out[k++] = to_unit(r[0], r[1]);
+                ++i;
+                if (k == n) break;
+            }
+            out[k++] = to_unit(r[2], r[3]);
+            ++i;
+        }
+    }
+
+private:
+    /// 53-bit uniform double in [0, 1) from two 32-bit words
+    static double to_unit(std::uint32_t hi, std::uint32_t lo) {
+        const std::uint64_t bits =
+            (std::uint64_t{hi >> 5} << 26) | std::uint64_t{lo >> 6};
+        return static_cast<double>(bits) * 0x1.0p-53;
+    }
+
+    /// SplitMix64 finalizer, used to spread the seed over the key
+    static std::uint64_t splitmix64(std::uint64_t z) {
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    std::array<std::uint32_t, 2> key_; ///< Philox key
+};
+
+/**
+ * @brief Seed for runs without an explicit SolverParams::seed.
+ *
+ * std::random_device is read once per process; later calls offset that
+ * base with a counter, which costs an atomic increment instead of a
+ * system entropy request.
+ */
+inline std::uint64_t fresh_seed() {
+    static const std::uint64_t base =
+        (std::uint64_t{std::random_device{}()} << 32) | std::random_device{}();
+    static std::atomic<std::uint64_t> counter{0};
+    return base + 0x9E3779B97F4A7C15ull * counter.fetch_add(1);
+}
+
+} // namespace integ
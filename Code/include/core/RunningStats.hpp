@@ -0,0 +1,54 @@
+// RunningStats.hpp
+#pragma once
+#include <cstddef>
+
+namespace integ {
+
+/**
+ * @brief Running mean and variance (Welford), mergeable across partitions.
+ */
+struct RunningStats {
+    std::size_t count = 0; ///< Number of samples
+    double mean = 0.0;     ///< Sample mean
+    double m2 = 0.0;       ///< Sum of squared deviations from the mean
+
+    /**
+     * @brief Add one sample (Welford update)
+     * @param y Sample value
+     */
+    void add(double y) {
+        ++count;
+        const double delta = y - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (y - mean);
+    }
+
+    /**
+     * @brief Merge another accumulator (Chan et al. parallel formula)
+     *
+     * \f[
+     * \delta = \bar y_B - \bar y_A,\quad
+     * M_2 = M_{2,A} + M_{2,B} + \delta^2 \frac{n_A n_B}{n_A + n_B}
+     * \f]
+     *
+     * @param o Accumulator over a disjoint set of samples
+     */
+    void merge(const RunningStats& o) {
+        if (o.count == 0) return;
+        if (count == 0) { *this = o; return; }
+        const double na = static_cast<double>(count);
+        const double nb = static_cast<double>(o.count);
+        const double n = na + nb;
+        const double delta = o.mean - mean;
+        mean += delta * (nb / n);
+        m2 += o.m2 + delta * delta * (na * nb / n);
+        count += o.count;
+    }
+
+    /** @brief Unbiased sample variance (0 if fewer than two samples) */
+    double variance() const {
+        return (count > 1) ? m2 / static_cast<double>(count - 1) : 0.0;
+    }
+};
+
+} // namespace integ
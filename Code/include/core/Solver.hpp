@@ -1,18 +1,42 @@
 // Solver.hpp
 #pragma once
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <random>
 #include <string>
+#include <vector>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 
 #include "core/Interval.hpp"
 #include "core/IntegrationResult.hpp"
 #include "core/Function.hpp"
+#include "core/VectorFunction.hpp"
 
 namespace integ {
 
+/**
+ * @brief GSL integration routine used by GSLIntegrator.
+ */
+enum class GSLMethod {
+    QNG,   ///< Non-adaptive Gauss–Kronrod (10/21/43/87 points)
+    QAG,   ///< Adaptive Gauss–Kronrod with the rule given by gsl_key
+    QAGS,  ///< Adaptive Gauss–Kronrod (21 points) with extrapolation
+    CQUAD  ///< Doubly-adaptive Clenshaw–Curtis
+};
+
+/**
+ * @brief Variance reduction used by MonteCarloUniformSolver.
+ */
+enum class VarianceReduction {
+    None,        ///< Plain uniform sampling
+    Antithetic,  ///< Pairs x, a + b - x
+    Stratified,  ///< Equal allocation over n equal-width strata
+    Importance   ///< Sampling from importance_density via importance_inverse_cdf
+};
+
 /**
  * @brief Parameters for solvers.
  */
@@ -23,11 +47,52 @@ struct SolverParams {
     // Monte Carlo
     std::size_t n_samples = 100000;       ///< Number of samples
     std::optional<std::uint32_t> seed;    ///< Optional RNG seed
+    std::size_t qmc_replicates = 8;       ///< Independent randomized QMC replicates
+    VarianceReduction variance_reduction = VarianceReduction::None; ///< Monte Carlo variance reduction
+    std::shared_ptr<const Function> importance_density;     ///< Normalized sampling density q on I
+    std::shared_ptr<const Function> importance_inverse_cdf; ///< Inverse CDF of q, from [0,1) to I
+
+    // Adaptive methods
+    double abs_tol = 1e-8;                ///< Absolute tolerance
+    double rel_tol = 1e-8;                ///< Relative tolerance
+    std::size_t max_subdivisions = 1000;  ///< Maximum number of subintervals
+    std::size_t max_evaluations = 1000000; ///< Evaluation budget
+    double max_time_s = 0.0;              ///< Wall-time budget in seconds (0 = none); only used by AutoSolver
+
+    // GSL
+    std::size_t gsl_workspace_size = 1000; ///< Intervals per pooled GSL workspace
+    GSLMethod gsl_method = GSLMethod::QAGS; ///< GSL routine
+    int gsl_key = 2;                      ///< QAG rule: 1..6 = 15, 21, 31, 41, 51, 61 points
+
+    // Parallelism
+    std::size_t n_threads = 1;            ///< Worker threads (0 = hardware concurrency)
 
     // Misc
     bool compute_error_estimate = true;   ///< Whether to compute error estimate
 };
 
+/**
+ * @brief One (function, interval) pair of a batch.
+ */
+struct IntegrationProblem {
+    const Function* f = nullptr;         ///< Integrand (not owned)
+    Interval I;                          ///< Interval of integration
+    const SolverParams* params = nullptr; ///< Overrides the batch parameters if set (not owned)
+};
+
+/**
+ * @brief Aggregate statistics of Solver::integrate_batch.
+ */
+struct BatchStats {
+    std::size_t problems = 0;            ///< Number of problems
+    std::size_t failures = 0;            ///< Problems with success == false
+    std::size_t total_evaluations = 0;   ///< Sum of evaluations
+    std::size_t threads = 1;             ///< Threads used
+    double wall_time_s = 0.0;            ///< Wall time of the whole batch
+    double problems_per_second = 0.0;    ///< Throughput in problems
+    double evaluations_per_second = 0.0; ///< Throughput in evaluations
+};
+
 /**
  * @brief Base class for 1D integration solvers.
  */
@@ -38,7 +103,9 @@ public:
     /**
      * @brief Integrates safely, catching exceptions.
      * 
-     * If the integration fails, sets success=false and fills default values.
+     * If the integration throws, sets success=false and fills default
+     * values; otherwise the solver's own success flag is kept (e.g. false
+     * for a GSL routine that did not reach the tolerance).
      * 
      * @param f Function to integrate
      * @param I Interval
@@ -52,8 +119,7 @@ public:
     ) const {
         IntegrationResult result;
         try {
-            result = integrate(f, I, p);  // call derived solver
-            result.success = true;
+            result = integrate(f, I, p);  // call derived solver; keeps its success flag
         } catch (const std::exception& /*e*/) {
             result.success = false;
             result.value = std::numeric_limits<double>::quiet_NaN();
@@ -77,8 +143,137 @@ public:
         const SolverParams& p
     ) const = 0;
 
+    /**
+     * @brief Integrate many problems with this solver.
+     *
+     * Problems run on p.n_threads threads (each integrate call runs
+     * single-threaded), handed out longest-first by estimated_cost so
+     * that expensive problems do not end up last. Setup cached by the
+     * solver (Gauss–Legendre rules, GSL workspaces, ...) is shared by
+     * all problems. If the parameters of a problem carry a seed, problem
+     * i uses seed + i, so random solvers draw independent streams and
+     * the results do not depend on the scheduling.
+     *
+     * @param problems Problems to integrate
+     * @param p Parameters for problems without their own
+     * @param stats Optional output for aggregate statistics
+     * @return One result per problem, in input order (failures have success == false)
+     */
+    std::vector<IntegrationResult> integrate_batch(
+        const std::vector<IntegrationProblem>& problems,
+        const SolverParams& p,
+        BatchStats* stats = nullptr
+    ) const;
+
+    /**
+     * @brief Integrate every component of a vector-valued function in one pass.
+     *
+     * Walks the solver's fixed rule (rule_size / rule_nodes) in blocks:
+     * each block of nodes is generated once, all k components are
+     * evaluated with one VectorFunction::evaluate call, and k sums are
+     * accumulated side by side. The node range is reduced in fixed
+     * chunks on p.n_threads threads, so the sums do not depend on the
+     * thread count.
+     *
+     * @param f Vector-valued function
+     * @param I Interval
+     * @param p Solver parameters
+     * @return One result per component; evaluations is the shared number
+     *         of nodes and no error estimate is given
+     * @throws std::invalid_argument if the solver has no fixed rule
+     */
+    std::vector<IntegrationResult> integrate_vector(
+        const VectorFunction& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const;
+
+    /**
+     * @brief Relative cost of integrate(f, I, p), used to balance batches.
+     *
+     * Defaults to the size of the fixed rule, or p.max_evaluations for
+     * solvers without one.
+     *
+     * @param I Interval
+     * @param p Solver parameters
+     * @return Estimated cost (e.g. number of evaluations)
+     */
+    virtual double estimated_cost(const Interval& I, const SolverParams& p) const {
+        const std::size_t m = rule_size(I, p);
+        return static_cast<double>(m > 0 ? m : p.max_evaluations);
+    }
+
     /** @brief Name of the solver */
     virtual std::string name() const { return "Solver"; }
+
+    /**
+     * @brief Number of nodes of the solver's fixed quadrature rule on I.
+     *
+     * Solvers whose nodes and weights do not depend on f (composite and
+     * Gauss rules) return the node count, so callers can materialize
+     * the rule with rule_nodes(). Adaptive and random solvers return 0.
+     *
+     * @param I Interval
+     * @param p Solver parameters
+     * @return Number of nodes, or 0 if the solver has no fixed rule
+     */
+    virtual std::size_t rule_size(
+        const Interval& /*I*/,
+        const SolverParams& /*p*/
+    ) const {
+        return 0;
+    }
+
+    /**
+     * @brief Write nodes and weights [begin, end) of the fixed rule on I.
+     *
+     * The rule satisfies integrate(f, I, p).value ≈ sum_i w[i] f(x[i]).
+     *
+     * @param I Interval
+     * @param p Solver parameters
+     * @param begin First node index
+     * @param end One past the last node index (<= rule_size(I, p))
+     * @param x Output nodes (end - begin entries)
+     * @param w Output weights (end - begin entries)
+     * @throws std::logic_error if the solver has no fixed rule
+     */
+    virtual void rule_nodes(
+        const Interval& /*I*/,
+        const SolverParams& /*p*/,
+        std::size_t /*begin*/,
+        std::size_t /*end*/,
+        double* /*x*/,
+        double* /*w*/
+    ) const {
+        throw std::logic_error(name() + ": no fixed quadrature rule");
+    }
+
+    /**
+     * @brief Write the error weights [begin, end) of the rule's embedded estimate.
+     *
+     * For fixed rules whose integrate() estimates the error from the
+     * same nodes (e.g. by comparing with the rule of step 2h), the
+     * weights e satisfy integrate(f, I, p).error_estimate ==
+     * |sum_i e[i] f(x[i])| with x from rule_nodes. Callers that already
+     * hold f(x[i]) (nested or tensor-product integrals) thus get the
+     * estimate without evaluating f again.
+     *
+     * @param I Interval
+     * @param p Solver parameters
+     * @param begin First node index
+     * @param end One past the last node index (<= rule_size(I, p))
+     * @param e Output error weights (end - begin entries)
+     * @return false (and e untouched) if the rule has no embedded estimate
+     */
+    virtual bool rule_error_weights(
+        const Interval& /*I*/,
+        const SolverParams& /*p*/,
+        std::size_t /*begin*/,
+        std::size_t /*end*/,
+        double* /*e*/
+    ) const {
+        return false;
+    }
 };
 
 } // namespace integ
\ No newline at end of file
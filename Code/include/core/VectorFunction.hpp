@@ -0,0 +1,42 @@
+// VectorFunction.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Abstract base class for vector-valued 1D functions.
+ *
+ * A function x -> (f_0(x), ..., f_{k-1}(x)) whose k components are
+ * integrated together by Solver::integrate_vector: each node is
+ * generated and evaluated once for all components.
+ */
+class VectorFunction {
+public:
+    virtual ~VectorFunction() = default;
+
+    /**
+     * @brief Number of components k.
+     */
+    virtual std::size_t dimension() const = 0;
+
+    /**
+     * @brief Evaluate all components at n abscissae.
+     *
+     * The output is component-major (SoA): out[c * n + i] = f_c(x[i]).
+     *
+     * @param x Input values (n entries).
+     * @param out Output values (dimension() * n entries).
+     * @param n Number of points.
+     */
+    virtual void evaluate(const double* x, double* out, std::size_t n) const = 0;
+
+    /**
+     * @brief Optional function name (for logging or display).
+     * @return Name of the function.
+     */
+    virtual std::string name() const { return "VectorFunction"; }
+};
+
+} // namespace integ
@@ -6,7 +6,7 @@
 /**
  * @brief Represents the 2D function f(x,y) = exp(-x + y)
  */
-class ExpXY2D : public integ::Function2D {
+class ExpXY2D final : public integ::Function2D {
 public:
     /**
      * @brief Evaluate the function at (x, y)
@@ -17,4 +17,32 @@ public:
     double operator()(double x, double y) const override {
         return std::exp(-x + y);
     }
+
+    /**
+     * @brief Evaluate the function at n points (SoA)
+     * @param x x-coordinates
+     * @param y y-coordinates
+     * @param out Output values exp(-x + y)
+     * @param n Number of points
+     */
+    void evaluate(const double* x, const double* y, double* out,
+                  std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = std::exp(-x[i] + y[i]);
+        }
+    }
+
+    /**
+     * @brief Evaluate the function at n points with a fixed x
+     * @param x Fixed x-coordinate
+     * @param y y-coordinates
+     * @param out Output values exp(-x + y)
+     * @param n Number of points
+     */
+    void evaluate_y(double x, const double* y, double* out,
+                    std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = std::exp(-x + y[i]);
+        }
+    }
 };
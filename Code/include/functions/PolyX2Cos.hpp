@@ -8,7 +8,7 @@ namespace integ {
 /**
  * @brief Represents the function f(x) = x^2 * cos(x)
  */
-class PolyX2Cos : public Function {
+class PolyX2Cos final : public Function {
 public:
     /**
      * @brief Evaluate the function at x
@@ -18,6 +18,18 @@ public:
     double operator()(double x) const override {
         return x * x * std::cos(x);
     }
+
+    /**
+     * @brief Evaluate the function at n points
+     * @param x Input values
+     * @param y Output values x^2 * cos(x)
+     * @param n Number of points
+     */
+    void evaluate(const double* x, double* y, std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = x[i] * x[i] * std::cos(x[i]);
+        }
+    }
 };
 
 } // namespace integ
\ No newline at end of file
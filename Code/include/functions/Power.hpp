@@ -8,7 +8,7 @@ namespace integ {
 /**
  * @brief Represents the function f(x) = x^n
  */
-class Power : public Function {
+class Power final : public Function {
 public:
     /**
      * @brief Construct a Power function
@@ -25,6 +25,18 @@ public:
         return std::pow(x, n_);
     }
 
+    /**
+     * @brief Evaluate the function at n points
+     * @param x Input values
+     * @param y Output values x^n
+     * @param n Number of points
+     */
+    void evaluate(const double* x, double* y, std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = std::pow(x[i], n_);
+        }
+    }
+
 private:
     int n_; ///< Exponent
 };
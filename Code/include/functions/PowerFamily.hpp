@@ -0,0 +1,48 @@
+// PowerFamily.hpp
+#pragma once
+#include "core/VectorFunction.hpp"
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace integ {
+
+/**
+ * @brief Represents the family f_c(x) = x^{n_c} for several exponents
+ */
+class PowerFamily final : public VectorFunction {
+public:
+    /**
+     * @brief Construct the family
+     * @param exponents Exponents n_0, ..., n_{k-1}
+     */
+    explicit PowerFamily(std::vector<int> exponents) : n_(std::move(exponents)) {}
+
+    /**
+     * @brief Number of exponents
+     */
+    std::size_t dimension() const override { return n_.size(); }
+
+    /**
+     * @brief Evaluate every x^{n_c} at n points
+     * @param x Input values
+     * @param out Output values, out[c * n + i] = x[i]^{n_c}
+     * @param n Number of points
+     */
+    void evaluate(const double* x, double* out, std::size_t n) const override {
+        for (std::size_t c = 0; c < n_.size(); ++c) {
+            const int e = n_[c];
+            double* y = out + c * n;
+            for (std::size_t i = 0; i < n; ++i) {
+                y[i] = std::pow(x[i], e);
+            }
+        }
+    }
+
+    std::string name() const override { return "PowerFamily"; }
+
+private:
+    std::vector<int> n_; ///< Exponents
+};
+
+} // namespace integ
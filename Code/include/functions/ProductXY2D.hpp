@@ -5,7 +5,7 @@
 /**
  * @brief 2D function f(x, y) = x * y
  */
-class ProductXY2D : public integ::Function2D {
+class ProductXY2D final : public integ::Function2D {
 public:
     /**
      * @brief Evaluate the function at (x, y)
@@ -16,4 +16,32 @@ public:
     double operator()(double x, double y) const override {
         return x * y;
     }
+
+    /**
+     * @brief Evaluate the function at n points (SoA)
+     * @param x x-coordinates
+     * @param y y-coordinates
+     * @param out Output values x * y
+     * @param n Number of points
+     */
+    void evaluate(const double* x, const double* y, double* out,
+                  std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = x[i] * y[i];
+        }
+    }
+
+    /**
+     * @brief Evaluate the function at n points with a fixed x
+     * @param x Fixed x-coordinate
+     * @param y y-coordinates
+     * @param out Output values x * y
+     * @param n Number of points
+     */
+    void evaluate_y(double x, const double* y, double* out,
+                    std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = x * y[i];
+        }
+    }
 };
\ No newline at end of file
@@ -6,7 +6,7 @@
 /**
  * @brief 2D function f(x, y) = x^2 + y^2
  */
-class SumSquaresXY2D : public integ::Function2D {
+class SumSquaresXY2D final : public integ::Function2D {
 public:
     /**
      * @brief Evaluate the function at (x, y)
@@ -17,4 +17,33 @@ public:
     double operator()(double x, double y) const override {
         return x*x + y*y;
     }
+
+    /**
+     * @brief Evaluate the function at n points (SoA)
+     * @param x x-coordinates
+     * @param y y-coordinates
+     * @param out Output values x^2 + y^2
+     * @param n Number of points
+     */
+    void evaluate(const double* x, const double* y, double* out,
+                  std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = x[i]*x[i] + y[i]*y[i];
+        }
+    }
+
+    /**
+     * @brief Evaluate the function at n points with a fixed x
+     * @param x Fixed x-coordinate
+     * @param y y-coordinates
+     * @param out Output values x^2 + y^2
+     * @param n Number of points
+     */
+    void evaluate_y(double x, const double* y, double* out,
+                    std::size_t n) const override {
+        const double x2 = x * x;
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = x2 + y[i]*y[i];
+        }
+    }
 };
\ No newline at end of file
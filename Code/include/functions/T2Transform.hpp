@@ -1,5 +1,6 @@
 // T2Transform.hpp
 #pragma once
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -13,7 +14,7 @@ namespace integ {
  * This changes int_{0}^{1} f(x) dx into int_{0}^{1} f(t^{2}) * 2t dt.
  * Useful for functions not defined at x=0 (e.g., log(x), 1/sqrt(x)).
  */
-class T2Transform : public Function {
+class T2Transform final : public Function {
 public:
     /**
      * @brief Construct the transform
@@ -42,6 +43,31 @@ public:
         return (*base_)(x) * 2.0 * t;
     }
 
+    /**
+     * @brief Evaluate the transformed function at n points
+     *
+     * Squares the inputs into a local block and forwards it to the
+     * base function's batch call.
+     *
+     * @param t Input values
+     * @param y Output values f(t^2) * 2t
+     * @param n Number of points
+     */
+    void evaluate(const double* t, double* y, std::size_t n) const override {
+        double x[batch_size];
+        for (std::size_t i0 = 0; i0 < n; i0 += batch_size) {
+            const std::size_t m = std::min(batch_size, n - i0);
+            for (std::size_t k = 0; k < m; ++k) {
+                x[k] = t[i0 + k] * t[i0 + k];
+            }
+            base_->evaluate(x, y + i0, m);
+            for (std::size_t k = 0; k < m; ++k) {
+                const double tk = t[i0 + k];
+                y[i0 + k] = (tk == 0.0) ? value_at_t0_ : y[i0 + k] * 2.0 * tk;
+            }
+        }
+    }
+
     /**
      * @brief Return the function name
      */
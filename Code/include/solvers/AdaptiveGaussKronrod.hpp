@@ -0,0 +1,53 @@
+// AdaptiveGaussKronrod.hpp
+#pragma once
+#include "core/Solver.hpp"
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Gauss–Kronrod pair used on each subinterval.
+ */
+enum class GaussKronrodRule {
+    G7K15,  ///< 7-point Gauss embedded in 15-point Kronrod
+    G10K21  ///< 10-point Gauss embedded in 21-point Kronrod
+};
+
+/**
+ * @brief Globally adaptive Gauss–Kronrod quadrature.
+ *
+ * Keeps the subintervals in a max-heap ordered by error estimate and
+ * repeatedly bisects the worst one until the tolerance is met. All
+ * subintervals live in an arena reserved up front, so splitting does
+ * not allocate. Endpoints are never evaluated, which makes the solver
+ * usable on integrable endpoint singularities.
+ */
+class AdaptiveGaussKronrodSolver : public Solver {
+public:
+    /**
+     * @brief Construct the solver
+     * @param rule Gauss–Kronrod pair applied on each subinterval
+     */
+    explicit AdaptiveGaussKronrodSolver(GaussKronrodRule rule = GaussKronrodRule::G10K21);
+
+    /**
+     * @brief Integrate a function f over interval I
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters (abs_tol, rel_tol, max_subdivisions, max_evaluations)
+     * @return IntegrationResult with value and error estimate
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override;
+
+    /** @brief Return the solver name */
+    std::string name() const override;
+
+private:
+    GaussKronrodRule rule_; ///< Gauss–Kronrod pair
+};
+
+} // namespace integ
@@ -0,0 +1,67 @@
+// AutoSolver.hpp
+#pragma once
+#include "core/Solver.hpp"
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Solver chosen by AutoSolver (stored in meta["auto_decision"]).
+ */
+enum class AutoDecision {
+    GaussLegendre = 0,        ///< Gauss–Legendre probe already converged
+    Simpson = 1,              ///< Composite Simpson with a predicted n
+    AdaptiveGaussKronrod = 2, ///< Adaptive G10K21
+    MonteCarlo = 3            ///< Uniform Monte Carlo (last resort)
+};
+
+/**
+ * @brief Picks the cheapest adequate solver for a target tolerance.
+ *
+ * Probes the integrand in stages and stops at the first one that meets
+ * max(p.abs_tol, p.rel_tol * |I|):
+ * 1. Gauss–Legendre of orders 10, 20, 40 (smooth integrands);
+ * 2. f at and near both endpoints: a non-finite value or a blow-up
+ *    marks an endpoint singularity and goes straight to stage 4;
+ * 3. composite Simpson with 16, 32, 64 panels: if the differences
+ *    shrink by ~16 (the h^4 regime), Simpson runs with the n predicted
+ *    for the tolerance;
+ * 4. adaptive Gauss–Kronrod within the remaining budget;
+ * 5. if that does not converge, Monte Carlo with the remaining budget.
+ *
+ * Every stage's estimate is kept as a candidate, with |Q_40 - Q_20| as
+ * the Gauss–Legendre error and |S_64 - S_32| / 15 as the Simpson one.
+ * If no stage meets the tolerance, or the budget runs out before stages
+ * 4 and 5 can run, the candidate with the smallest error is returned
+ * and "auto_decision" names the stage it came from.
+ *
+ * The budget is p.max_evaluations and, if p.max_time_s > 0, the number
+ * of evaluations that fit in the remaining time at the cost per
+ * evaluation measured by the probes. The returned evaluations include
+ * the probes; meta holds the decision ("auto_decision", an AutoDecision),
+ * "probe_evaluations", "probe_time_s", "endpoint_singular" (1 = left,
+ * 2 = right) and, when computed, "simpson_ratio".
+ */
+class AutoSolver : public Solver {
+public:
+    /**
+     * @brief Integrate f over I to the requested tolerance
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters (abs_tol, rel_tol, max_evaluations, max_time_s, n_threads, seed)
+     * @return IntegrationResult of the chosen solver, with the decision in meta
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override;
+
+    /** @brief Return the solver name */
+    std::string name() const override { return "Auto"; }
+
+    /** @brief Readable name of a decision */
+    static std::string decision_name(AutoDecision d);
+};
+
+} // namespace integ
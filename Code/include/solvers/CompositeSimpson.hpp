@@ -28,6 +28,28 @@ public:
 
     /** @brief Return the solver name */
     std::string name() const override { return "CompositeSimpson"; }
+
+    /** @brief Number of nodes of the rule on I (see Solver::rule_size) */
+    std::size_t rule_size(const Interval& I, const SolverParams& p) const override;
+
+    /** @brief Nodes and weights [begin, end) of the rule on I */
+    void rule_nodes(
+        const Interval& I,
+        const SolverParams& p,
+        std::size_t begin,
+        std::size_t end,
+        double* x,
+        double* w
+    ) const override;
+
+    /** @brief Error weights [begin, end) of the embedded estimate (see Solver::rule_error_weights) */
+    bool rule_error_weights(
+        const Interval& I,
+        const SolverParams& p,
+        std::size_t begin,
+        std::size_t end,
+        double* e
+    ) const override;
 };
 
 } // namespace integ
\ No newline at end of file
@@ -4,26 +4,56 @@
 #include "../core/Function.hpp"
 #include "../core/Interval.hpp"
 #include <gsl/gsl_integration.h>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace integ {
 
 /**
  * @brief Integration using GSL (GNU Scientific Library) routines.
  * 
- * Uses GSL adaptive integration methods to compute definite integrals
- * of 1D functions over a given interval.
+ * Uses GSL integration routines (QNG, QAG, QAGS or CQUAD, selected by
+ * SolverParams::gsl_method) to compute definite integrals of 1D
+ * functions over a given interval.
+ *
+ * GSL workspaces are kept in a pool owned by the integrator and reused
+ * across calls (including concurrent calls from several threads), so a
+ * workspace is only allocated when no pooled one is large enough.
  */
 struct GSLIntegrator : public Solver {
-    /** @brief Default constructor */
+    /**
+     * @brief Default constructor
+     *
+     * Calls disable_gsl_error_handler().
+     */
     GSLIntegrator();
 
+    /**
+     * @brief Turn off GSL's default error handler, once per process
+     *
+     * GSL's default handler aborts the process on any error; with it off,
+     * errors come back as status codes (see integrate). The handler is
+     * global, so this affects every GSL user in the process. Only the
+     * first call has an effect; it is safe to call from several threads.
+     */
+    static void disable_gsl_error_handler();
+
+    /** @brief Free all pooled workspaces */
+    ~GSLIntegrator() override;
+
+    GSLIntegrator(const GSLIntegrator&) = delete;
+    GSLIntegrator& operator=(const GSLIntegrator&) = delete;
+
     /**
      * @brief Integrate a function f over interval I
      * @param f Function to integrate
      * @param I Interval of integration
      * @param params Solver parameters (subdivisions, samples, etc.)
-     * @return IntegrationResult containing integral value, error, and metadata
+     * @return IntegrationResult containing integral value, error, and metadata;
+     *         success is false if GSL returned a nonzero status
      */
     IntegrationResult integrate(
         const Function& f,
@@ -33,6 +63,34 @@ struct GSLIntegrator : public Solver {
 
     /** @brief Return the solver name */
     std::string name() const override { return "GSLIntegrator"; }
+
+    /** @brief Number of calls served by a pooled workspace */
+    std::size_t pool_hits() const { return hits_.load(); }
+
+    /** @brief Number of calls that had to allocate a new workspace */
+    std::size_t pool_misses() const { return misses_.load(); }
+
+private:
+    /**
+     * @brief Take a workspace with at least `size` intervals from the pool
+     * (or allocate one if none fits)
+     */
+    gsl_integration_workspace* acquire_workspace(std::size_t size) const;
+
+    /** @brief Return a workspace to the pool */
+    void release_workspace(gsl_integration_workspace* w) const;
+
+    /** @brief Same as acquire_workspace, for CQUAD workspaces */
+    gsl_integration_cquad_workspace* acquire_cquad_workspace(std::size_t size) const;
+
+    /** @brief Return a CQUAD workspace to the pool */
+    void release_cquad_workspace(gsl_integration_cquad_workspace* w) const;
+
+    mutable std::mutex pool_mutex_;                       ///< Guards both pools
+    mutable std::vector<gsl_integration_workspace*> pool_; ///< Idle workspaces
+    mutable std::vector<gsl_integration_cquad_workspace*> cquad_pool_; ///< Idle CQUAD workspaces
+    mutable std::atomic<std::size_t> hits_{0};            ///< Pool hits
+    mutable std::atomic<std::size_t> misses_{0};          ///< Pool misses
 };
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
@@ -1,6 +1,7 @@
 // GaussLegendre.hpp
 #pragma once
 #include "core/Solver.hpp"
+#include "solvers/GaussLegendreRule.hpp"
 #include <string>
 #include <cstddef>
 
@@ -10,20 +11,27 @@ namespace integ {
  * @brief Gauss-Legendre quadrature solver for 1D integration.
  * 
  * Approximates the integral using Gauss-Legendre quadrature of a given order.
+ * Rules of any order are computed once and shared through a process-wide
+ * cache (see gauss_legendre_rule), so constructing a solver is cheap.
+ *
+ * In composite mode the interval is split into SolverParams::n equal
+ * panels and the rule is applied on each of them.
  */
 class GaussLegendreSolver : public Solver {
 public:
     /**
      * @brief Construct a Gauss-Legendre solver
      * @param order Number of points in quadrature (default 5)
+     * @param composite Apply the rule on p.n panels instead of once
+     * @throws std::invalid_argument if order is 0 or above max_gauss_legendre_order
      */
-    explicit GaussLegendreSolver(std::size_t order = 5);
+    explicit GaussLegendreSolver(std::size_t order = 5, bool composite = false);
 
     /**
      * @brief Integrate a function f over interval I
      * @param f Function to integrate
      * @param I Interval of integration
-     * @param p Solver parameters (unused here but included for consistency)
+     * @param p Solver parameters (number of panels and threads in composite mode)
      * @return IntegrationResult containing integral value, error, and metadata
      */
     IntegrationResult integrate(
@@ -35,8 +43,30 @@ public:
     /** @brief Return the solver name */
     std::string name() const override;
 
+    /** @brief Number of nodes of the rule on I (see Solver::rule_size) */
+    std::size_t rule_size(const Interval& I, const SolverParams& p) const override;
+
+    /** @brief Nodes and weights [begin, end) of the rule on I */
+    void rule_nodes(
+        const Interval& I,
+        const SolverParams& p,
+        std::size_t begin,
+        std::size_t end,
+        double* x,
+        double* w
+    ) const override;
+
 private:
-    std::size_t order_; ///< Quadrature order (2, 3, or 5)
+    /// Composite rule over p.n panels
+    IntegrationResult integrate_composite(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const;
+
+    std::size_t order_;             ///< Quadrature order
+    const GaussLegendreRule* rule_; ///< Cached nodes and weights on [-1,1]
+    bool composite_;                ///< Composite mode
 };
 
 } // namespace integ
\ No newline at end of file
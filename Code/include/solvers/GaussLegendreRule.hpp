@@ -0,0 +1,33 @@
+// GaussLegendreRule.hpp
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace integ {
+
+/// Largest order accepted by gauss_legendre_rule
+inline constexpr std::size_t max_gauss_legendre_order = 1000;
+
+/**
+ * @brief Nodes and weights of an m-point Gauss–Legendre rule on [-1, 1].
+ */
+struct GaussLegendreRule {
+    std::vector<double> nodes;   ///< Nodes in ascending order
+    std::vector<double> weights; ///< Matching weights
+};
+
+/**
+ * @brief Get the m-point Gauss–Legendre rule on [-1, 1].
+ *
+ * The rule is computed on first request (Newton iteration on the
+ * Legendre polynomial P_m) and stored in a process-wide cache; later
+ * requests for the same order return the cached rule. Safe to call
+ * from several threads.
+ *
+ * @param order Number of points m (1 <= m <= max_gauss_legendre_order)
+ * @return Reference to the cached rule, valid until program exit
+ * @throws std::invalid_argument if the order is out of range
+ */
+const GaussLegendreRule& gauss_legendre_rule(std::size_t order);
+
+} // namespace integ
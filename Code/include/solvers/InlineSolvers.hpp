@@ -0,0 +1,326 @@
+// InlineSolvers.hpp
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "core/Interval.hpp"
+#include "core/IntegrationResult.hpp"
+#include "core/Parallel.hpp"
+#include "core/Philox.hpp"
+#include "core/RunningStats.hpp"
+#include "core/Solver.hpp"
+#include "solvers/GaussLegendreRule.hpp"
+
+namespace integ {
+
+/**
+ * @brief Header-only solver kernels templated on the integrand type.
+ *
+ * Each kernel takes any callable `double(double)` by const reference.
+ * Since the integrand type is a template parameter the call is resolved
+ * at compile time and can be inlined into the node loop (for the
+ * catalogue classes, which are `final`, this holds even when they are
+ * passed by their concrete type). The kernels mirror the virtual solvers
+ * but run on the calling thread. The quadrature kernels sum their nodes
+ * serially, whereas the virtual solvers sum in chunks, so the values
+ * agree only up to rounding; the Monte Carlo kernel accumulates in the
+ * same chunks as MonteCarloUniformSolver.
+ */
+namespace kernels {
+
+/**
+ * @brief Composite trapezoid rule with n subintervals
+ *
+ * If error_estimate is set and n is even, the error is estimated by
+ * |T_n - T_{n/2}| / 3 from the same nodes (as in CompositeTrapezoidSolver).
+ */
+template <class F>
+IntegrationResult composite_trapezoid(const F& f, const Interval& I, std::size_t n,
+                                      bool error_estimate = true)
+{
+    if (n == 0) {
+        throw std::invalid_argument("CompositeTrapezoid: n must be >= 1");
+    }
+    const double a = I.a();
+    const double h = I.length() / static_cast<double>(n);
+
+    double odd = 0.0;
+    double even = 0.0;
+    for (std::size_t i = 1; i < n; i += 2) {
+        odd += f(a + h * static_cast<double>(i));
+    }
+    for (std::size_t i = 2; i < n; i += 2) {
+        even += f(a + h * static_cast<double>(i));
+    }
+    const double ends = 0.5 * (f(a) + f(I.b()));
+
+    IntegrationResult res;
+    res.value = h * (ends + odd + even);
+    res.evaluations = n + 1;
+    if (error_estimate && n % 2 == 0) {
+        res.has_error_estimate = true;
+        res.error_estimate = std::abs(res.value - 2.0 * h * (ends + even)) / 3.0;
+    }
+    return res;
+}
+
+/**
+ * @brief Composite Simpson rule with n (even) subintervals
+ *
+ * If error_estimate is set, the error is estimated as in
+ * CompositeSimpsonSolver: |S_n - S_{n/2}| / 15 when 4 divides n,
+ * |S_n - T_n| otherwise.
+ */
+template <class F>
+IntegrationResult composite_simpson(const F& f, const Interval& I, std::size_t n,
+                                    bool error_estimate = true)
+{
+    if (n < 2 || n % 2 != 0) {
+        throw std::invalid_argument("CompositeSimpson: n must be even and >= 2");
+    }
+    const double a = I.a();
+    const double h = I.length() / static_cast<double>(n);
+
+    // s[r]: nodes with index i % 4 == r
+    double s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (std::size_t i = 1; i < n; ++i) {
+        s[i % 4] += f(a + h * static_cast<double>(i));
+    }
+    const double ends = f(a) + f(I.b());
+
+    IntegrationResult res;
+    res.value = (h / 3.0) * (ends + 4.0 * (s[1] + s[3]) + 2.0 * (s[0] + s[2]));
+    res.evaluations = n + 1;
+    if (!error_estimate) {
+        return res;
+    }
+    res.has_error_estimate = true;
+    if (n % 4 == 0) {
+        const double coarse = (2.0 * h / 3.0) * (ends + 4.0 * s[2] + 2.0 * s[0]);
+        res.error_estimate = std::abs(res.value - coarse) / 15.0;
+    } else {
+        const double trap = h * (0.5 * ends + s[0] + s[1] + s[2] + s[3]);
+        res.error_estimate = std::abs(res.value - trap);
+    }
+    return res;
+}
+
+/**
+ * @brief Gauss–Legendre rule applied on `panels` equal panels
+ * @param rule Rule on [-1, 1] (e.g. from gauss_legendre_rule)
+ */
+template <class F>
+IntegrationResult gauss_legendre(const F& f, const Interval& I,
+                                 const GaussLegendreRule& rule,
+                                 std::size_t panels = 1)
+{
+    if (panels == 0) {
+        throw std::invalid_argument("GaussLegendre: panels must be >= 1");
+    }
+    const std::size_t m = rule.nodes.size();
+    const double H = I.length() / static_cast<double>(panels);
+    const double half = 0.5 * H;
+
+    double sum = 0.0;
+    for (std::size_t j = 0; j < panels; ++j) {
+        const double mid = I.a() + H * (static_cast<double>(j) + 0.5);
+        for (std::size_t k = 0; k < m; ++k) {
+            sum += rule.weights[k] * f(mid + half * rule.nodes[k]);
+        }
+    }
+
+    IntegrationResult res;
+    res.value = half * sum;
+    res.evaluations = panels * m;
+    return res;
+}
+
+/**
+ * @brief Plain Monte Carlo with n uniform samples (Philox stream of `seed`)
+ *
+ * Uses the same sample stream as MonteCarloUniformSolver for a given
+ * seed, and the same accumulation: Welford within chunks of
+ * reduction_chunk samples, chunks merged in order with Chan's formula.
+ * The standard error is reported if error_estimate is set and n > 1.
+ */
+template <class F>
+IntegrationResult monte_carlo_uniform(const F& f, const Interval& I,
+                                      std::size_t n, std::uint64_t seed,
+                                      bool error_estimate = true)
+{
+    if (n == 0) {
+        throw std::invalid_argument("MonteCarloUniform: n_samples must be >= 1");
+    }
+    const Philox4x32 rng(seed);
+    const double a = I.a();
+    const double L = I.length();
+
+    double u[batch_size];
+    RunningStats stats;
+    for (std::size_t c0 = 0; c0 < n; c0 += reduction_chunk) {
+        const std::size_t c1 = (n - c0 < reduction_chunk) ? n : c0 + reduction_chunk;
+        RunningStats chunk;
+        for (std::size_t i0 = c0; i0 < c1; i0 += batch_size) {
+            const std::size_t m = (c1 - i0 < batch_size) ? c1 - i0 : batch_size;
+            rng.fill_uniform(i0, u, m);
+            for (std::size_t k = 0; k < m; ++k) {
+                chunk.add(f(a + L * u[k]));
+            }
+        }
+        stats.merge(chunk);
+    }
+
+    IntegrationResult res;
+    res.value = L * stats.mean;
+    res.evaluations = n;
+    if (error_estimate && n > 1) {
+        res.has_error_estimate = true;
+        res.error_estimate = L * std::sqrt(stats.variance() / static_cast<double>(n));
+        res.meta["var_f"] = stats.variance();
+    }
+    return res;
+}
+
+/**
+ * @brief Iterated 2D integral with a 1D kernel in each direction
+ *
+ * `rule(g, J)` must integrate the callable g over the Interval J
+ * (typically a lambda forwarding to one of the kernels above). Both the
+ * inner integrand y -> f(x, y) and the outer integrand are lambdas, so
+ * the whole nest is visible to the compiler.
+ *
+ * @param f Callable double(double x, double y)
+ * @param domain Any type with x_interval(), y_min(x) and y_max(x)
+ * @param rule Generic callable (g, Interval) -> IntegrationResult
+ * @throws std::invalid_argument if a y bound is not finite or y_max(x) < y_min(x)
+ */
+template <class F2, class Domain, class Rule>
+IntegrationResult nested(const F2& f, const Domain& domain, const Rule& rule) {
+    std::size_t inner_evals = 0;
+
+    auto outer = [&](double x) {
+        const double y0 = domain.y_min(x);
+        const double y1 = domain.y_max(x);
+        if (!std::isfinite(y0) || !std::isfinite(y1) || y1 < y0) {
+            throw std::invalid_argument(
+                "nested: y bounds must be finite with y_min(x) <= y_max(x)"
+            );
+        }
+        if (y1 == y0) return 0.0; // zero-width slice
+        auto fy = [&f, x](double y) { return f(x, y); };
+        const IntegrationResult r = rule(fy, Interval(y0, y1));
+        inner_evals += r.evaluations;
+        return r.value;
+    };
+
+    IntegrationResult res = rule(outer, domain.x_interval());
+    res.evaluations = inner_evals;
+    res.has_error_estimate = false;
+    return res;
+}
+
+/// Kernel functor: composite trapezoid with p.n subintervals
+struct Trapezoid {
+    template <class F>
+    IntegrationResult operator()(const F& f, const Interval& I, const SolverParams& p) const {
+        return composite_trapezoid(f, I, p.n, p.compute_error_estimate);
+    }
+    std::string name() const { return "CompositeTrapezoid"; }
+};
+
+/// Kernel functor: composite Simpson with p.n subintervals
+struct Simpson {
+    template <class F>
+    IntegrationResult operator()(const F& f, const Interval& I, const SolverParams& p) const {
+        return composite_simpson(f, I, p.n, p.compute_error_estimate);
+    }
+    std::string name() const { return "CompositeSimpson"; }
+};
+
+/// Kernel functor: Gauss–Legendre of a given order, optionally on p.n panels
+struct GaussLegendre {
+    explicit GaussLegendre(std::size_t order = 5, bool on_panels = false)
+        : rule(&gauss_legendre_rule(order)), composite(on_panels)
+    {}
+
+    template <class F>
+    IntegrationResult operator()(const F& f, const Interval& I, const SolverParams& p) const {
+        return gauss_legendre(f, I, *rule, composite ? p.n : 1);
+    }
+    std::string name() const {
+        return std::string(composite ? "CompositeGaussLegendre" : "GaussLegendre")
+             + "(order=" + std::to_string(rule->nodes.size()) + ")";
+    }
+
+    const GaussLegendreRule* rule; ///< Cached rule
+    bool composite;                ///< Apply on p.n panels
+};
+
+/// Kernel functor: Monte Carlo with p.n_samples samples and p.seed
+struct MonteCarlo {
+    template <class F>
+    IntegrationResult operator()(const F& f, const Interval& I, const SolverParams& p) const {
+        IntegrationResult res = monte_carlo_uniform(
+            f, I, p.n_samples, p.seed.has_value() ? *p.seed : fresh_seed(),
+            p.compute_error_estimate);
+        if (p.seed.has_value()) {
+            res.meta["seed"] = static_cast<double>(*p.seed);
+        }
+        return res;
+    }
+    std::string name() const { return "MonteCarloUniform"; }
+};
+
+} // namespace kernels
+
+/**
+ * @brief Thin Solver adapter running a kernel specialized for integrand F.
+ *
+ * When the Function passed to integrate() is an F, the kernel runs on
+ * the concrete type (no virtual call per node); any other Function is
+ * still accepted and goes through the virtual call.
+ *
+ * @tparam F Concrete Function type the kernel is specialized for
+ * @tparam Kernel One of the kernels:: functors
+ */
+template <class F, class Kernel>
+class InlineSolver : public Solver {
+public:
+    /**
+     * @brief Construct the adapter
+     * @param kernel Kernel functor (e.g. kernels::GaussLegendre(10, true))
+     */
+    explicit InlineSolver(Kernel kernel = Kernel())
+        : kernel_(std::move(kernel))
+    {}
+
+    /**
+     * @brief Integrate f over I with the specialized kernel
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters
+     * @return IntegrationResult from the kernel
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override {
+        if (const F* g = dynamic_cast<const F*>(&f)) {
+            return kernel_(*g, I, p);
+        }
+        return kernel_([&f](double x) { return f(x); }, I, p);
+    }
+
+    /** @brief Return the solver name */
+    std::string name() const override { return "Inline" + kernel_.name(); }
+
+private:
+    Kernel kernel_; ///< Kernel functor
+};
+
+} // namespace integ
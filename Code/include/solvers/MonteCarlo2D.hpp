@@ -0,0 +1,46 @@
+// MonteCarlo2D.hpp
+#pragma once
+#include "core/Function2D.hpp"
+#include "core/Domain2D.hpp"
+#include "core/Solver.hpp"
+#include "core/IntegrationResult.hpp"
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Monte Carlo integration directly over a 2D domain.
+ *
+ * Samples X uniformly on the x-interval, then Y uniformly on
+ * [y_min(X), y_max(X)], and averages the weighted values
+ * \f[
+ * L_x\,\bigl(y_{\max}(X) - y_{\min}(X)\bigr)\, f(X, Y),
+ * \f]
+ * an unbiased estimator of the integral. One sample costs one
+ * evaluation of f, against one full inner integral per outer sample
+ * when Monte Carlo is nested inside NestedIntegral2D.
+ */
+class MonteCarlo2D {
+public:
+    /**
+     * @brief Compute the integral of f over the domain
+     * @param f 2D function f(x, y)
+     * @param domain Integration domain
+     * @param p Solver parameters (n_samples, seed, n_threads, compute_error_estimate)
+     * @return IntegrationResult with value, standard error, etc.
+     * @throws std::invalid_argument if p.n_samples is 0, or a sampled y bound
+     *         is not finite or has y_max(x) < y_min(x)
+     */
+    IntegrationResult integrate(
+        const Function2D& f,
+        const Domain2D& domain,
+        const SolverParams& p
+    ) const;
+
+    /**
+     * @brief Return the solver name
+     */
+    std::string name() const { return "MonteCarlo2D"; }
+};
+
+} // namespace integ
@@ -10,6 +10,8 @@ namespace integ {
  * 
  * Generates random points uniformly in the interval and estimates
  * the integral using the average value of the function.
+ * SolverParams::variance_reduction switches to antithetic, stratified
+ * or importance sampling.
  */
 class MonteCarloUniformSolver : public Solver {
 public:
@@ -17,7 +19,7 @@ public:
      * @brief Compute the integral of f over the interval I
      * @param f Function to integrate
      * @param I Interval of integration
-     * @param p Solver parameters (number of samples, seed, etc.)
+     * @param p Solver parameters (number of samples, seed, variance reduction, etc.)
      * @return IntegrationResult with value, error estimate, etc.
      */
     IntegrationResult integrate(
@@ -26,6 +28,11 @@ public:
         const SolverParams& p
     ) const override;
 
+    /** @brief Cost estimate: p.n_samples evaluations */
+    double estimated_cost(const Interval& /*I*/, const SolverParams& p) const override {
+        return static_cast<double>(p.n_samples);
+    }
+
     /**
      * @brief Return the solver name
      */
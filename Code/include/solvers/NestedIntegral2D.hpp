@@ -12,6 +12,16 @@ namespace integ {
  * 
  * The outer integral is performed over x, and for each x, 
  * the inner integral is performed over y.
+ *
+ * When the outer solver has a fixed rule (Solver::rule_size > 0) the
+ * outer nodes and weights are materialized first and the inner
+ * integrals are spread over SolverParams::n_threads threads. The inner
+ * solver is then called concurrently and must be safe to share across
+ * threads (all solvers of this library are).
+ *
+ * Rectangular domains with fixed rules in both directions are handed
+ * to TensorProduct2D, which evaluates the same grid in batched tiles
+ * and reports the same error estimate and counters.
  */
 class NestedIntegral2D {
 public:
@@ -31,6 +41,7 @@ public:
      * @param domain Domain in x and y
      * @param params Solver parameters
      * @return IntegrationResult with value, error estimate, etc.
+     * @throws std::invalid_argument if a y bound is not finite or y_max(x) < y_min(x)
      */
     IntegrationResult integrate(
         const Function2D& f,
@@ -43,4 +54,4 @@ private:
     const Solver& inner_; ///< Solver for y-direction
 };
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
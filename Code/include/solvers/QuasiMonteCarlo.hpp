@@ -0,0 +1,90 @@
+// QuasiMonteCarlo.hpp
+#pragma once
+#include "core/Solver.hpp"
+#include "core/Function2D.hpp"
+#include "core/Domain2D.hpp"
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Low-discrepancy sequence used by QuasiMonteCarloSolver.
+ */
+enum class QMCSequence {
+    Sobol,  ///< Sobol sequence (base 2), randomized by a digital shift
+    Halton  ///< Halton sequence (bases 2 and 3), randomized by a random shift
+};
+
+/**
+ * @brief Quasi-Monte Carlo integration with Sobol or Halton points.
+ *
+ * Replaces the pseudo-random samples of Monte Carlo by a low-discrepancy
+ * sequence, which converges like O(log(N)^d / N) on smooth integrands
+ * instead of O(1/sqrt(N)).
+ *
+ * In randomized mode p.n_samples is split into p.qmc_replicates
+ * independently randomized copies of the point set (keyed by p.seed);
+ * the result is the mean of the replicates and the error estimate their
+ * standard error. Unrandomized, all samples form one deterministic point
+ * set (index 0, a corner of the domain, is skipped) and no error
+ * estimate is given.
+ */
+class QuasiMonteCarloSolver : public Solver {
+public:
+    /**
+     * @brief Construct the solver
+     * @param sequence Low-discrepancy sequence
+     * @param randomized Use randomized replicates (gives an error estimate)
+     */
+    explicit QuasiMonteCarloSolver(
+        QMCSequence sequence = QMCSequence::Sobol,
+        bool randomized = true
+    );
+
+    /**
+     * @brief Compute the integral of f over the interval I
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters (n_samples, qmc_replicates, seed, n_threads)
+     * @return IntegrationResult with value and replicate standard error
+     * @throws std::invalid_argument if there are fewer samples than replicates
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override;
+
+    /**
+     * @brief Compute the integral of f over a 2D domain
+     *
+     * Coordinate 0 gives x, coordinate 1 gives y in [y_min(x), y_max(x)],
+     * weighted as in MonteCarlo2D.
+     *
+     * @param f 2D function f(x, y)
+     * @param domain Integration domain
+     * @param p Solver parameters (n_samples, qmc_replicates, seed, n_threads)
+     * @return IntegrationResult with value and replicate standard error
+     * @throws std::invalid_argument if there are fewer samples than replicates,
+     *         or a sampled y bound is not finite or has y_max(x) < y_min(x)
+     */
+    IntegrationResult integrate(
+        const Function2D& f,
+        const Domain2D& domain,
+        const SolverParams& p
+    ) const;
+
+    /** @brief Cost estimate: p.n_samples evaluations */
+    double estimated_cost(const Interval& /*I*/, const SolverParams& p) const override {
+        return static_cast<double>(p.n_samples);
+    }
+
+    /** @brief Return the solver name */
+    std::string name() const override;
+
+private:
+    QMCSequence sequence_; ///< Point set
+    bool randomized_;      ///< Randomized replicates
+};
+
+} // namespace integ
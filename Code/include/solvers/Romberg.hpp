@@ -0,0 +1,34 @@
+// Romberg.hpp
+#pragma once
+#include "core/Solver.hpp"
+#include <string>
+
+namespace integ {
+
+/**
+ * @brief Romberg integration (trapezoid rule + Richardson extrapolation).
+ *
+ * Halves the trapezoid step at each level, evaluating only the new
+ * midpoints, and extrapolates the sequence of trapezoid sums with the
+ * Richardson tableau until the tolerance is met.
+ */
+class RombergSolver : public Solver {
+public:
+    /**
+     * @brief Integrate a function f over interval I
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters (abs_tol, rel_tol, max_evaluations, n_threads)
+     * @return IntegrationResult with value and error estimate
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override;
+
+    /** @brief Return the solver name */
+    std::string name() const override { return "Romberg"; }
+};
+
+} // namespace integ
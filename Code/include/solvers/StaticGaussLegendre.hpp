@@ -0,0 +1,263 @@
+// StaticGaussLegendre.hpp
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "core/Solver.hpp"
+
+namespace integ {
+
+/**
+ * @brief Nodes and weights of an N-point Gauss–Legendre rule on [-1, 1].
+ * @tparam N Number of points
+ */
+template <std::size_t N>
+struct StaticGaussLegendreRule {
+    std::array<double, N> nodes{};   ///< Nodes in ascending order
+    std::array<double, N> weights{}; ///< Matching weights
+};
+
+namespace detail {
+
+/// |x| usable in constant expressions
+constexpr double ce_abs(double x) {
+    return x < 0.0 ? -x : x;
+}
+
+/// cos(x) for x in [0, pi] by its Taylor series, usable in constant expressions
+constexpr double ce_cos(double x) {
+    const double x2 = x * x;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k <= 30; ++k) {
+        term *= -x2 / static_cast<double>((2 * k - 1) * (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Compute the N-point rule at compile time
+ *
+ * Same algorithm as gauss_legendre_rule(): Newton iteration on P_N from
+ * the guesses cos(pi (i + 3/4) / (N + 1/2)), with P_N evaluated by the
+ * three-term recurrence.
+ */
+template <std::size_t N>
+constexpr StaticGaussLegendreRule<N> make_static_gauss_legendre() {
+    constexpr double pi = 3.14159265358979323846;
+    constexpr double nd = static_cast<double>(N);
+
+    StaticGaussLegendreRule<N> rule{};
+    for (std::size_t i = 0; i < (N + 1) / 2; ++i) {
+        double z = ce_cos(pi * (static_cast<double>(i) + 0.75) / (nd + 0.5));
+        double dp = 0.0;
+
+        for (int it = 0; it < 100; ++it) {
+            double p0 = 1.0;
+            double p1 = z;
+            for (std::size_t j = 2; j <= N; ++j) {
+                const double jd = static_cast<double>(j);
+                const double p2 = ((2.0 * jd - 1.0) * z * p1 - (jd - 1.0) * p0) / jd;
+                p0 = p1;
+                p1 = p2;
+            }
+            dp = nd * (z * p1 - p0) / (z * z - 1.0);
+
+            const double dz = p1 / dp;
+            z -= dz;
+            if (ce_abs(dz) <= 1e-16) break;
+        }
+
+        if (N % 2 == 1 && i == N / 2) z = 0.0;
+
+        const double w = 2.0 / ((1.0 - z * z) * dp * dp);
+        rule.nodes[i] = -z;
+        rule.nodes[N - 1 - i] = z;
+        rule.weights[i] = w;
+        rule.weights[N - 1 - i] = w;
+    }
+    return rule;
+}
+
+/// Weighted sum with the loop fully unrolled (fold expression)
+template <std::size_t N, std::size_t... K>
+constexpr double unrolled_dot(const std::array<double, N>& w,
+                              const double* y,
+                              std::index_sequence<K...>)
+{
+    return ((w[K] * y[K]) + ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief N-point Gauss–Legendre rule, computed entirely at compile time.
+ */
+template <std::size_t N>
+inline constexpr StaticGaussLegendreRule<N> static_gauss_legendre_rule =
+    detail::make_static_gauss_legendre<N>();
+
+/// Orders up to this value get a fully unrolled weighted sum
+inline constexpr std::size_t static_unroll_limit = 16;
+
+namespace kernels {
+
+/**
+ * @brief Apply the compile-time N-point rule on `panels` panels of I
+ *
+ * For N <= static_unroll_limit the weighted sum over the nodes of a
+ * panel is fully unrolled.
+ *
+ * @tparam N Number of points
+ * @param f Callable double(double)
+ * @param I Interval of integration
+ * @param panels Number of equal panels
+ */
+template <std::size_t N, class F>
+IntegrationResult static_gauss_legendre(const F& f, const Interval& I,
+                                        std::size_t panels = 1)
+{
+    static_assert(N >= 1, "Gauss-Legendre order must be >= 1");
+    constexpr const StaticGaussLegendreRule<N>& rule = static_gauss_legendre_rule<N>;
+
+    if (panels == 0) {
+        throw std::invalid_argument("StaticGaussLegendre: panels must be >= 1");
+    }
+    const double H = I.length() / static_cast<double>(panels);
+    const double half = 0.5 * H;
+
+    double sum = 0.0;
+    double y[N];
+    for (std::size_t j = 0; j < panels; ++j) {
+        const double mid = I.a() + H * (static_cast<double>(j) + 0.5);
+        for (std::size_t k = 0; k < N; ++k) {
+            y[k] = f(mid + half * rule.nodes[k]);
+        }
+        if constexpr (N <= static_unroll_limit) {
+            sum += detail::unrolled_dot(rule.weights, y, std::make_index_sequence<N>{});
+        } else {
+            for (std::size_t k = 0; k < N; ++k) {
+                sum += rule.weights[k] * y[k];
+            }
+        }
+    }
+
+    IntegrationResult res;
+    res.value = half * sum;
+    res.evaluations = panels * N;
+    return res;
+}
+
+} // namespace kernels
+
+/**
+ * @brief Gauss–Legendre solver whose order is a template parameter.
+ *
+ * The rule is a compile-time constant, so construction costs nothing
+ * and there is no cache lookup. Each panel is evaluated with one batch
+ * call on its N nodes.
+ *
+ * @tparam N Number of points
+ */
+template <std::size_t N>
+class StaticGaussLegendreSolver : public Solver {
+    static_assert(N >= 1, "Gauss-Legendre order must be >= 1");
+
+public:
+    /**
+     * @brief Construct the solver
+     * @param composite Apply the rule on p.n panels instead of once
+     */
+    explicit StaticGaussLegendreSolver(bool composite = false)
+        : composite_(composite)
+    {}
+
+    /**
+     * @brief Integrate a function f over interval I
+     * @param f Function to integrate
+     * @param I Interval of integration
+     * @param p Solver parameters (p.n panels in composite mode)
+     * @return IntegrationResult containing the integral value
+     */
+    IntegrationResult integrate(
+        const Function& f,
+        const Interval& I,
+        const SolverParams& p
+    ) const override {
+        constexpr const StaticGaussLegendreRule<N>& rule = static_gauss_legendre_rule<N>;
+
+        const std::size_t panels = composite_ ? p.n : 1;
+        if (panels == 0) {
+            throw std::invalid_argument("StaticGaussLegendre: n must be >= 1");
+        }
+        const double H = I.length() / static_cast<double>(panels);
+        const double half = 0.5 * H;
+
+        double sum = 0.0;
+        double x[N];
+        double y[N];
+        for (std::size_t j = 0; j < panels; ++j) {
+            const double mid = I.a() + H * (static_cast<double>(j) + 0.5);
+            for (std::size_t k = 0; k < N; ++k) {
+                x[k] = mid + half * rule.nodes[k];
+            }
+            f.evaluate(x, y, N);
+            if constexpr (N <= static_unroll_limit) {
+                sum += detail::unrolled_dot(rule.weights, y, std::make_index_sequence<N>{});
+            } else {
+                for (std::size_t k = 0; k < N; ++k) {
+                    sum += rule.weights[k] * y[k];
+                }
+            }
+        }
+
+        IntegrationResult res;
+        res.value = half * sum;
+        res.evaluations = panels * N;
+        return res;
+    }
+
+    /** @brief N nodes, or p.n * N in composite mode */
+    std::size_t rule_size(const Interval& /*I*/, const SolverParams& p) const override {
+        if (!composite_) return N;
+        if (p.n == 0) {
+            throw std::invalid_argument("StaticGaussLegendre: n must be >= 1");
+        }
+        return p.n * N;
+    }
+
+    /** @brief Mapped nodes and scaled weights, panel-major */
+    void rule_nodes(
+        const Interval& I,
+        const SolverParams& p,
+        std::size_t begin,
+        std::size_t end,
+        double* x,
+        double* w
+    ) const override {
+        constexpr const StaticGaussLegendreRule<N>& rule = static_gauss_legendre_rule<N>;
+        const std::size_t panels = rule_size(I, p) / N;
+        const double H = I.length() / static_cast<double>(panels);
+        const double half = 0.5 * H;
+        for (std::size_t i = begin; i < end; ++i) {
+            const double mid = I.a() + H * (static_cast<double>(i / N) + 0.5);
+            x[i - begin] = mid + half * rule.nodes[i % N];
+            w[i - begin] = half * rule.weights[i % N];
+        }
+    }
+
+    /** @brief Return the solver name */
+    std::string name() const override {
+        return std::string(composite_ ? "StaticCompositeGaussLegendre" : "StaticGaussLegendre")
+             + "(order=" + std::to_string(N) + ")";
+    }
+
+private:
+    bool composite_; ///< Composite mode
+};
+
+} // namespace integ
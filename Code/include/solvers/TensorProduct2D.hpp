@@ -0,0 +1,65 @@
+// TensorProduct2D.hpp
+#pragma once
+#include "core/Function2D.hpp"
+#include "core/Domain2D.hpp"
+#include "core/Solver.hpp"
+#include "core/IntegrationResult.hpp"
+
+namespace integ {
+
+/**
+ * @brief Tensor-product cubature on rectangular domains.
+ *
+ * Combines the fixed 1D rules of two solvers (trapezoid, Simpson,
+ * Gauss–Legendre, ...) into
+ * \f[
+ * \iint f \approx \sum_i \sum_j w^x_i\, w^y_j\, f(x_i, y_j).
+ * \f]
+ * The grid is walked in cache-sized tiles; each tile is written as SoA
+ * coordinate arrays and evaluated with one Function2D::evaluate call.
+ *
+ * NestedIntegral2D hands rectangles with fixed rules in both
+ * directions to this class. The result carries the same error estimate
+ * (from the rules' embedded estimates, see Solver::rule_error_weights)
+ * and the same meta counters ("outer_nodes", "inner_calls",
+ * "total_f_calls", "max_inner_error", "outer_error"), plus
+ * "tensor_product", "nx" and "ny".
+ */
+class TensorProduct2D {
+public:
+    /**
+     * @brief Construct the cubature
+     * @param x_solver Solver providing the rule in x (needs a fixed rule)
+     * @param y_solver Solver providing the rule in y (needs a fixed rule)
+     */
+    TensorProduct2D(
+        const Solver& x_solver,
+        const Solver& y_solver
+    );
+
+    /**
+     * @brief True if both solvers have a fixed rule on the domain
+     * and the domain is a rectangle
+     */
+    bool supports(const Domain2D& domain, const SolverParams& params) const;
+
+    /**
+     * @brief Compute the integral over a rectangular domain
+     * @param f 2D function f(x, y)
+     * @param domain Rectangular domain
+     * @param params Solver parameters (rules use params.n; params.n_threads threads)
+     * @return IntegrationResult with value, error estimate, evaluations and counters
+     * @throws std::invalid_argument if supports() is false
+     */
+    IntegrationResult integrate(
+        const Function2D& f,
+        const Domain2D& domain,
+        const SolverParams& params
+    ) const;
+
+private:
+    const Solver& x_; ///< Rule in x
+    const Solver& y_; ///< Rule in y
+};
+
+} // namespace integ
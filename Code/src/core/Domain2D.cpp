@@ -4,35 +4,55 @@
 namespace integ {
 
 /**
- * @brief Construct a 2D domain
+ * @brief Construct a 2D domain with general bounds
  */
 Domain2D::Domain2D(
     Interval x_interval,
     std::function<double(double)> y_min,
     std::function<double(double)> y_max
 )
-    : x_(x_interval), y_min_(y_min), y_max_(y_max)
-{}
+    : x_(x_interval)
+{
+    lo_.general = true;
+    lo_.f = std::move(y_min);
+    hi_.general = true;
+    hi_.f = std::move(y_max);
+}
+
+/**
+ * @brief Construct a rectangular domain
+ */
+Domain2D::Domain2D(Interval x_interval, Interval y_interval)
+    : x_(x_interval)
+{
+    lo_.c0 = y_interval.a();
+    hi_.c0 = y_interval.b();
+}
 
 /**
- * @brief Return the x-interval
+ * @brief Construct a domain with affine bounds
  */
-const Interval& Domain2D::x_interval() const {
-    return x_;
+Domain2D::Domain2D(Interval x_interval, AffineBound y_min, AffineBound y_max)
+    : x_(x_interval)
+{
+    lo_.c0 = y_min.intercept;
+    lo_.c1 = y_min.slope;
+    hi_.c0 = y_max.intercept;
+    hi_.c1 = y_max.slope;
 }
 
 /**
- * @brief Lower bound in y for a given x
+ * @brief Whether the y bounds are constant
  */
-double Domain2D::y_min(double x) const {
-    return y_min_(x);
+bool Domain2D::is_rectangle() const {
+    return is_affine() && lo_.c1 == 0.0 && hi_.c1 == 0.0;
 }
 
 /**
- * @brief Upper bound in y for a given x
+ * @brief Whether the y bounds are stored as coefficients
  */
-double Domain2D::y_max(double x) const {
-    return y_max_(x);
+bool Domain2D::is_affine() const {
+    return !lo_.general && !hi_.general;
 }
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
@@ -0,0 +1,123 @@
+// Parallel.cpp
+#include "core/Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace integ {
+
+/**
+ * @brief Resolve a requested thread count (0 = hardware concurrency)
+ */
+std::size_t resolve_threads(std::size_t requested) {
+    if (requested == 0) {
+        requested = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(requested, 1);
+}
+
+/**
+ * @brief Threads actually started by parallel_for (calling thread included)
+ */
+std::size_t threads_used(std::size_t n_tasks, std::size_t n_threads) {
+    return std::max<std::size_t>(std::min(resolve_threads(n_threads), n_tasks), 1);
+}
+
+/**
+ * @brief Run tasks on a group of threads with dynamic scheduling
+ *
+ * The calling thread takes part in the work, so n_threads - 1
+ * additional threads are started.
+ */
+void parallel_for(
+    std::size_t n_tasks,
+    std::size_t n_threads,
+    const std::function<void(std::size_t)>& task
+)
+{
+    const std::size_t t = threads_used(n_tasks, n_threads);
+
+    if (t <= 1) {
+        for (std::size_t i = 0; i < n_tasks; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto worker = [&]() {
+        for (;;) {
+            const std::size_t i = next.fetch_add(1);
+            if (i >= n_tasks) return;
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+                next.store(n_tasks); // stop handing out work
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(t - 1);
+    for (std::size_t k = 1; k < t; ++k) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Pairwise (cascade) summation
+ */
+double pairwise_sum(const double* v, std::size_t n) {
+    if (n <= 8) {
+        double s = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            s += v[i];
+        }
+        return s;
+    }
+    const std::size_t half = n / 2;
+    return pairwise_sum(v, half) + pairwise_sum(v + half, n - half);
+}
+
+/**
+ * @brief Deterministic chunked parallel sum
+ */
+double chunked_sum(
+    std::size_t n,
+    std::size_t n_threads,
+    const std::function<double(std::size_t, std::size_t)>& partial,
+    std::size_t chunk
+)
+{
+    if (n == 0) return 0.0;
+
+    const std::size_t n_chunks = (n + chunk - 1) / chunk;
+    std::vector<double> partials(n_chunks, 0.0);
+
+    parallel_for(n_chunks, n_threads, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t end = std::min(n, begin + chunk);
+        partials[c] = partial(begin, end);
+    });
+
+    return pairwise_sum(partials.data(), n_chunks);
+}
+
+} // namespace integ
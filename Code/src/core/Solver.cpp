@@ -0,0 +1,152 @@
+// Solver.cpp
+#include "core/Solver.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+
+namespace integ {
+
+/**
+ * @brief Integrate a batch of problems, longest first
+ */
+std::vector<IntegrationResult> Solver::integrate_batch(
+    const std::vector<IntegrationProblem>& problems,
+    const SolverParams& p,
+    BatchStats* stats
+) const
+{
+    const std::size_t n = problems.size();
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // Per-problem parameters: single-threaded, seed offset by the index
+    std::vector<SolverParams> params;
+    params.reserve(n);
+    std::vector<double> cost(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        params.push_back(problems[i].params ? *problems[i].params : p);
+        SolverParams& pi = params.back();
+        pi.n_threads = 1;
+        if (pi.seed.has_value()) {
+            pi.seed = static_cast<std::uint32_t>(*pi.seed + i);
+        }
+        cost[i] = estimated_cost(problems[i].I, pi);
+    }
+
+    // Longest-processing-time-first order, dynamically scheduled
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&cost](std::size_t a, std::size_t b) {
+        return cost[a] > cost[b];
+    });
+
+    std::vector<IntegrationResult> results(n);
+    parallel_for(n, p.n_threads, [&](std::size_t k) {
+        const std::size_t i = order[k];
+        const IntegrationProblem& pb = problems[i];
+        if (pb.f == nullptr) {
+            results[i].success = false;
+            results[i].value = std::numeric_limits<double>::quiet_NaN();
+            return;
+        }
+        results[i] = integrate_safe(*pb.f, pb.I, params[i]);
+    });
+
+    if (stats) {
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - t0;
+
+        BatchStats s;
+        s.problems = n;
+        s.threads = threads_used(n, p.n_threads);
+        s.wall_time_s = elapsed.count();
+        for (const IntegrationResult& r : results) {
+            s.failures += r.success ? 0 : 1;
+            s.total_evaluations += r.evaluations;
+        }
+        if (s.wall_time_s > 0.0) {
+            s.problems_per_second = static_cast<double>(n) / s.wall_time_s;
+            s.evaluations_per_second =
+                static_cast<double>(s.total_evaluations) / s.wall_time_s;
+        }
+        *stats = s;
+    }
+
+    return results;
+}
+
+/**
+ * @brief Single pass over the fixed rule with k accumulators
+ *
+ * \[
+ * I_c \approx \sum_i w_i\, f_c(x_i), \qquad c = 0, \dots, k-1
+ * \]
+ */
+std::vector<IntegrationResult> Solver::integrate_vector(
+    const VectorFunction& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    const std::size_t n = rule_size(I, p);
+    if (n == 0) {
+        throw std::invalid_argument(
+            name() + ": integrate_vector needs a solver with a fixed rule"
+        );
+    }
+    const std::size_t k = f.dimension();
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // partials[c * k + j]: sum of component j over chunk c
+    const std::size_t n_chunks = (n + reduction_chunk - 1) / reduction_chunk;
+    std::vector<double> partials(n_chunks * k, 0.0);
+
+    parallel_for(n_chunks, p.n_threads, [&](std::size_t c) {
+        const std::size_t begin = c * reduction_chunk;
+        const std::size_t end = std::min(n, begin + reduction_chunk);
+
+        double x[batch_size];
+        double w[batch_size];
+        std::vector<double> y(k * batch_size);
+        double* acc = partials.data() + c * k;
+
+        for (std::size_t i0 = begin; i0 < end; i0 += batch_size) {
+            const std::size_t m = std::min(batch_size, end - i0);
+            rule_nodes(I, p, i0, i0 + m, x, w);
+            f.evaluate(x, y.data(), m);
+
+            for (std::size_t j = 0; j < k; ++j) {
+                const double* yj = y.data() + j * m;
+                double s = 0.0;
+                for (std::size_t i = 0; i < m; ++i) {
+                    s += w[i] * yj[i];
+                }
+                acc[j] += s;
+            }
+        }
+    });
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
+
+    // Reduce each component over the chunks
+    std::vector<IntegrationResult> results(k);
+    std::vector<double> column(n_chunks);
+    for (std::size_t j = 0; j < k; ++j) {
+        for (std::size_t c = 0; c < n_chunks; ++c) {
+            column[c] = partials[c * k + j];
+        }
+        IntegrationResult& r = results[j];
+        r.value = pairwise_sum(column.data(), n_chunks);
+        r.evaluations = n;
+        r.meta["components"] = static_cast<double>(k);
+        r.meta["threads"] = static_cast<double>(threads_used(n_chunks, p.n_threads));
+        r.meta["wall_time_s"] = elapsed.count();
+    }
+
+    return results;
+}
+
+} // namespace integ
@@ -0,0 +1,274 @@
+// AdaptiveGaussKronrod.cpp
+#include "solvers/AdaptiveGaussKronrod.hpp"
+#include "core/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace integ {
+
+namespace {
+
+/**
+ * @brief Abscissae and weights of a Gauss–Kronrod pair on [-1, 1]
+ * (QUADPACK qk15 / qk21 tables).
+ *
+ * xgk holds the non-negative Kronrod nodes in decreasing order, the
+ * last one being 0. Entries with an odd index are also Gauss nodes,
+ * with Gauss weight wg[j / 2].
+ */
+struct KronrodTable {
+    const double* xgk;
+    const double* wgk;
+    const double* wg;
+    std::size_t n_half; ///< Number of entries in xgk / wgk
+};
+
+const double xgk15[8] = {
+    0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245, 0.000000000000000000000000000000000
+};
+const double wgk15[8] = {
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714
+};
+const double wg7[4] = {
+    0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975, 0.417959183673469387755102040816327
+};
+
+const double xgk21[11] = {
+    0.995657163025808080735527280689003, 0.973906528517171720077964012084452,
+    0.930157491355708226001207180059508, 0.865063366688984510732096688423493,
+    0.780817726586416897063717578345042, 0.679409568299024406234327365114874,
+    0.562757134668604683339000099272694, 0.433395394129247190799265943165784,
+    0.294392862701460198131126603103866, 0.148874338981631210884826001129720,
+    0.000000000000000000000000000000000
+};
+const double wgk21[11] = {
+    0.011694638867371874278064396062192, 0.032558162307964727478818972459390,
+    0.054755896574351996031381300244580, 0.075039674810919952767043140916190,
+    0.093125454583697605535065465083366, 0.109387158802297641899210590325805,
+    0.123491976262065851077208977449165, 0.134709217311473325928054001771707,
+    0.142775938577060080797094273138717, 0.147739104901338491374841515972068,
+    0.149445554002916905664936468389821
+};
+const double wg10[5] = {
+    0.066671344308688137593568809893332, 0.149451349150580593145776339657697,
+    0.219086362515982043995534934228163, 0.269266719309996355091226921569469,
+    0.295524224714752870173892994651338
+};
+
+const KronrodTable& table_for(GaussKronrodRule rule) {
+    static const KronrodTable t15{ xgk15, wgk15, wg7, 8 };
+    static const KronrodTable t21{ xgk21, wgk21, wg10, 11 };
+    return rule == GaussKronrodRule::G7K15 ? t15 : t21;
+}
+
+/**
+ * @brief One subinterval with its Kronrod value and error estimate
+ */
+struct Segment {
+    double a;
+    double b;
+    double value;
+    double error;
+};
+
+/// Max-heap order on the error estimate
+bool less_error(const Segment& s, const Segment& t) {
+    return s.error < t.error;
+}
+
+/**
+ * @brief Kronrod value and QUADPACK error estimate on [a, b]
+ *
+ * @param fx Function values at the Kronrod nodes, laid out as
+ *        (c - h x_0, c + h x_0, c - h x_1, c + h x_1, ..., c)
+ */
+Segment apply_rule(const KronrodTable& t, double a, double b, const double* fx) {
+    const double half = 0.5 * (b - a);
+    const std::size_t last = t.n_half - 1;
+
+    double kronrod = t.wgk[last] * fx[2 * last];
+    double gauss = (last % 2 == 1) ? t.wg[last / 2] * fx[2 * last] : 0.0;
+    double abs_k = std::abs(kronrod);
+
+    for (std::size_t j = 0; j < last; ++j) {
+        const double pair = fx[2 * j] + fx[2 * j + 1];
+        kronrod += t.wgk[j] * pair;
+        abs_k += t.wgk[j] * (std::abs(fx[2 * j]) + std::abs(fx[2 * j + 1]));
+        if (j % 2 == 1) {
+            gauss += t.wg[j / 2] * pair;
+        }
+    }
+
+    // Deviation of f from its mean, used to scale the raw error
+    const double mean = 0.5 * kronrod;
+    double asc = t.wgk[last] * std::abs(fx[2 * last] - mean);
+    for (std::size_t j = 0; j < last; ++j) {
+        asc += t.wgk[j] * (std::abs(fx[2 * j] - mean) + std::abs(fx[2 * j + 1] - mean));
+    }
+
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double tiny = std::numeric_limits<double>::min();
+
+    const double result = kronrod * half;
+    const double result_abs = abs_k * std::abs(half);
+    const double result_asc = asc * std::abs(half);
+    double err = std::abs((kronrod - gauss) * half);
+
+    if (result_asc != 0.0 && err != 0.0) {
+        err = result_asc * std::min(1.0, std::pow(200.0 * err / result_asc, 1.5));
+    }
+    if (result_abs > tiny / (50.0 * eps)) {
+        err = std::max(50.0 * eps * result_abs, err);
+    }
+
+    return Segment{ a, b, result, err };
+}
+
+/**
+ * @brief Write the Kronrod nodes of [a, b] into x (layout of apply_rule)
+ */
+void fill_nodes(const KronrodTable& t, double a, double b, double* x) {
+    const double c = 0.5 * (a + b);
+    const double half = 0.5 * (b - a);
+    const std::size_t last = t.n_half - 1;
+    for (std::size_t j = 0; j < last; ++j) {
+        x[2 * j] = c - half * t.xgk[j];
+        x[2 * j + 1] = c + half * t.xgk[j];
+    }
+    x[2 * last] = c;
+}
+
+} // namespace
+
+/**
+ * @brief Construct the solver
+ */
+AdaptiveGaussKronrodSolver::AdaptiveGaussKronrodSolver(GaussKronrodRule rule)
+    : rule_(rule)
+{}
+
+/**
+ * @brief Solver name including the Gauss–Kronrod pair
+ */
+std::string AdaptiveGaussKronrodSolver::name() const {
+    return rule_ == GaussKronrodRule::G7K15
+        ? "AdaptiveGK(G7K15)"
+        : "AdaptiveGK(G10K21)";
+}
+
+/**
+ * @brief Globally adaptive integration
+ *
+ * 1. Apply the Gauss–Kronrod pair on [a,b].
+ * 2. While the total error exceeds max(abs_tol, rel_tol |I|), pop the
+ *    subinterval with the largest error, bisect it and evaluate both
+ *    halves with a single batch call.
+ * 3. Stop early when p.max_subdivisions subintervals exist or the next
+ *    split would exceed p.max_evaluations.
+ *
+ * The returned error_estimate is the sum of the subinterval errors.
+ * meta["intervals"] holds the number of subintervals and
+ * meta["converged"] is 1 if the tolerance was met.
+ */
+IntegrationResult AdaptiveGaussKronrodSolver::integrate(
+    const Function& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    if (p.max_subdivisions == 0) {
+        throw std::invalid_argument(
+            "AdaptiveGaussKronrod: max_subdivisions must be >= 1"
+        );
+    }
+
+    const KronrodTable& t = table_for(rule_);
+    const std::size_t K = 2 * t.n_half - 1; // points per rule
+
+    if (p.max_evaluations < K) {
+        throw std::invalid_argument(
+            "AdaptiveGaussKronrod: max_evaluations is below one rule application"
+        );
+    }
+
+    // Arena for all subintervals, used as a max-heap on the error
+    std::vector<Segment> heap;
+    heap.reserve(p.max_subdivisions);
+
+    double xs[42];
+    double ys[42];
+
+    fill_nodes(t, I.a(), I.b(), xs);
+    f.evaluate(xs, ys, K);
+    heap.push_back(apply_rule(t, I.a(), I.b(), ys));
+    std::size_t evals = K;
+
+    double total = heap.front().value;
+    double total_err = heap.front().error;
+    bool converged = false;
+
+    for (;;) {
+        if (total_err <= std::max(p.abs_tol, p.rel_tol * std::abs(total))) {
+            converged = true;
+            break;
+        }
+        if (heap.size() >= p.max_subdivisions || evals + 2 * K > p.max_evaluations) {
+            break;
+        }
+
+        // Take the worst subinterval out of the heap
+        std::pop_heap(heap.begin(), heap.end(), less_error);
+        const Segment worst = heap.back();
+        heap.pop_back();
+
+        // Bisect it and evaluate both halves in one batch
+        const double mid = 0.5 * (worst.a + worst.b);
+        fill_nodes(t, worst.a, mid, xs);
+        fill_nodes(t, mid, worst.b, xs + K);
+        f.evaluate(xs, ys, 2 * K);
+        evals += 2 * K;
+
+        const Segment left = apply_rule(t, worst.a, mid, ys);
+        const Segment right = apply_rule(t, mid, worst.b, ys + K);
+
+        total += (left.value + right.value) - worst.value;
+        total_err += (left.error + right.error) - worst.error;
+
+        heap.push_back(left);
+        std::push_heap(heap.begin(), heap.end(), less_error);
+        heap.push_back(right);
+        std::push_heap(heap.begin(), heap.end(), less_error);
+    }
+
+    // Recompute the totals from the segments to drop the drift of the
+    // running updates
+    std::vector<double> values(heap.size());
+    std::vector<double> errors(heap.size());
+    for (std::size_t i = 0; i < heap.size(); ++i) {
+        values[i] = heap[i].value;
+        errors[i] = heap[i].error;
+    }
+
+    IntegrationResult res;
+    res.value = pairwise_sum(values.data(), values.size());
+    res.evaluations = evals;
+    res.has_error_estimate = true;
+    res.error_estimate = pairwise_sum(errors.data(), errors.size());
+    res.meta["intervals"] = static_cast<double>(heap.size());
+    res.meta["converged"] = converged ? 1.0 : 0.0;
+
+    return res;
+}
+
+} // namespace integ
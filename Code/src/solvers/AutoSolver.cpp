@@ -0,0 +1,260 @@
+// AutoSolver.cpp
+#include "solvers/AutoSolver.hpp"
+#include "solvers/AdaptiveGaussKronrod.hpp"
+#include "solvers/CompositeSimpson.hpp"
+#include "solvers/GaussLegendre.hpp"
+#include "solvers/MonteCarloUniform.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace integ {
+
+namespace {
+
+/// Inward offsets (fractions of the length) used by the endpoint probe
+constexpr double endpoint_offsets[] = {1e-2, 1e-4, 1e-6, 1e-8};
+constexpr std::size_t n_offsets = sizeof(endpoint_offsets) / sizeof(endpoint_offsets[0]);
+
+/// |f| may grow by this factor over the typical magnitude near an endpoint
+constexpr double blowup_factor = 1e2;
+
+/// Evaluations of one G10K21 application, the least the adaptive stage needs
+constexpr std::size_t gk_rule_evaluations = 21;
+
+/// Accepted range of |S_32 - S_16| / |S_64 - S_32| (16 in the h^4 regime)
+constexpr double simpson_ratio_min = 12.0;
+constexpr double simpson_ratio_max = 20.0;
+
+/**
+ * @brief Endpoint singularity probe
+ * @param scale Typical |f| on the interval
+ * @return Bit 0 set for the left endpoint, bit 1 for the right one
+ */
+int endpoint_singularities(const Function& f, const Interval& I, double scale) {
+    const double a = I.a();
+    const double b = I.b();
+    const double L = I.length();
+
+    // [a, a + L*d_k..., b, b - L*d_k...]
+    double xs[2 * (n_offsets + 1)];
+    double ys[2 * (n_offsets + 1)];
+    xs[0] = a;
+    xs[n_offsets + 1] = b;
+    for (std::size_t k = 0; k < n_offsets; ++k) {
+        xs[1 + k] = a + L * endpoint_offsets[k];
+        xs[n_offsets + 2 + k] = b - L * endpoint_offsets[k];
+    }
+    f.evaluate(xs, ys, 2 * (n_offsets + 1));
+
+    int mask = 0;
+    for (int side = 0; side < 2; ++side) {
+        const double* y = ys + side * (n_offsets + 1);
+        bool singular = false;
+        for (std::size_t k = 0; k <= n_offsets; ++k) {
+            singular = singular || !std::isfinite(y[k]);
+        }
+        singular = singular ||
+            std::abs(y[n_offsets]) > blowup_factor * (std::abs(y[1]) + scale);
+        if (singular) mask |= 1 << side;
+    }
+    return mask;
+}
+
+} // namespace
+
+/**
+ * @brief Staged solver selection (see AutoSolver)
+ */
+IntegrationResult AutoSolver::integrate(
+    const Function& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    auto elapsed = [&t0] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    };
+    auto tolerance = [&p](double value) {
+        return std::max(p.abs_tol, p.rel_tol * std::abs(value));
+    };
+
+    std::size_t used = 0;
+    IntegrationResult res;
+    AutoDecision decision = AutoDecision::GaussLegendre;
+    bool done = false;
+    int singular = 0;
+    double simpson_ratio = std::numeric_limits<double>::quiet_NaN();
+
+    // Best estimate so far: returned whenever a later stage cannot run
+    // or does worse
+    res.success = false;
+    auto consider = [&](const IntegrationResult& r, AutoDecision d) {
+        if (!r.success || !std::isfinite(r.value) || !r.has_error_estimate ||
+            !std::isfinite(r.error_estimate)) {
+            return;
+        }
+        if (!res.success || r.error_estimate < res.error_estimate) {
+            res = r;
+            decision = d;
+        }
+    };
+
+    // Stage 1: Gauss–Legendre of increasing order, |Q_m - Q_{m/2}| as error
+    IntegrationResult prev;
+    for (std::size_t order : {10, 20, 40}) {
+        IntegrationResult q = GaussLegendreSolver(order).integrate(f, I, p);
+        used += q.evaluations;
+        if (order > 10) {
+            q.has_error_estimate = true;
+            q.error_estimate = std::abs(q.value - prev.value);
+            consider(q, AutoDecision::GaussLegendre);
+            if (std::isfinite(q.value) && q.error_estimate <= tolerance(q.value)) {
+                res = q;
+                decision = AutoDecision::GaussLegendre;
+                done = true;
+                break;
+            }
+        }
+        prev = q;
+    }
+
+    // Stage 2: endpoint singularities
+    if (!done) {
+        const double scale = std::isfinite(prev.value) ? std::abs(prev.value) / I.length() : 0.0;
+        singular = endpoint_singularities(f, I, scale);
+        used += 2 * (n_offsets + 1);
+    }
+
+    // Stage 3: Simpson convergence ratio, |S_64 - S_32| / 15 as error
+    const CompositeSimpsonSolver simpson;
+    double err64 = std::numeric_limits<double>::quiet_NaN();
+    double tol64 = 0.0;
+    if (!done && singular == 0) {
+        SolverParams sp = p;
+        double s[3];
+        std::size_t n = 16;
+        for (double& v : s) {
+            sp.n = n;
+            const IntegrationResult r = simpson.integrate(f, I, sp);
+            used += r.evaluations;
+            v = r.value;
+            n *= 2;
+        }
+        const double d1 = std::abs(s[1] - s[0]);
+        const double d2 = std::abs(s[2] - s[1]);
+        err64 = d2 / 15.0;
+        tol64 = tolerance(s[2]);
+
+        IntegrationResult s64;
+        s64.value = s[2];
+        s64.has_error_estimate = true;
+        s64.error_estimate = err64;
+        consider(s64, AutoDecision::Simpson);
+
+        if (std::isfinite(s[2]) && err64 <= tol64) {
+            res = s64;
+            decision = AutoDecision::Simpson;
+            done = true;
+        } else if (std::isfinite(d1) && d2 > 0.0) {
+            simpson_ratio = d1 / d2;
+        }
+    }
+
+    const double probe_time = elapsed();
+    const std::size_t probe_evals = used;
+
+    // Remaining evaluations within the evaluation and time budgets
+    auto remaining = [&]() -> std::size_t {
+        std::size_t left = (p.max_evaluations > used) ? p.max_evaluations - used : 0;
+        if (p.max_time_s > 0.0 && probe_evals > 0) {
+            const double per_eval = probe_time / static_cast<double>(probe_evals);
+            const double t_left = std::max(0.0, p.max_time_s - elapsed());
+            left = std::min(left, static_cast<std::size_t>(t_left / std::max(per_eval, 1e-12)));
+        }
+        return left;
+    };
+
+    if (!done && tol64 > 0.0 &&
+        simpson_ratio >= simpson_ratio_min && simpson_ratio <= simpson_ratio_max) {
+        // Error ~ err64 * (64 / n)^4; aim at half the tolerance. Clamped
+        // to the budget before the cast (n_real may be huge)
+        const std::size_t budget = remaining();
+        const double n_real = 64.0 * std::pow(err64 / (0.5 * tol64), 0.25);
+        std::size_t n = static_cast<std::size_t>(
+            std::ceil(std::min(n_real, static_cast<double>(budget))));
+        n += n % 2;
+        if (n + 1 <= budget) {
+            SolverParams sp = p;
+            sp.n = n;
+            sp.compute_error_estimate = true;
+            const IntegrationResult r = simpson.integrate(f, I, sp);
+            used += r.evaluations;
+            consider(r, AutoDecision::Simpson);
+            if (r.has_error_estimate && r.error_estimate <= tolerance(r.value)) {
+                res = r;
+                decision = AutoDecision::Simpson;
+                done = true;
+            }
+        }
+    }
+
+    // Stage 4: adaptive Gauss–Kronrod, if one G10K21 application fits
+    if (!done && remaining() >= gk_rule_evaluations) {
+        SolverParams gp = p;
+        gp.max_evaluations = remaining();
+        const AdaptiveGaussKronrodSolver gk;
+        const IntegrationResult r = gk.integrate_safe(f, I, gp);
+        used += r.evaluations;
+        if (r.success && r.meta.count("converged") && r.meta.at("converged") == 1.0) {
+            res = r;
+            decision = AutoDecision::AdaptiveGaussKronrod;
+            done = true;
+        } else {
+            consider(r, AutoDecision::AdaptiveGaussKronrod);
+        }
+    }
+
+    // Stage 5: Monte Carlo with what is left
+    if (!done) {
+        SolverParams mp = p;
+        mp.n_samples = remaining();
+        mp.compute_error_estimate = true;
+        if (mp.n_samples >= 2) {
+            const MonteCarloUniformSolver mc;
+            const IntegrationResult r = mc.integrate_safe(f, I, mp);
+            used += r.evaluations;
+            consider(r, AutoDecision::MonteCarlo);
+        }
+    }
+
+    if (!res.success) {
+        // No stage produced a finite value with an error estimate
+        res.value = std::numeric_limits<double>::quiet_NaN();
+    }
+    res.evaluations = used;
+    res.meta["auto_decision"] = static_cast<double>(decision);
+    res.meta["probe_evaluations"] = static_cast<double>(probe_evals);
+    res.meta["probe_time_s"] = probe_time;
+    res.meta["endpoint_singular"] = static_cast<double>(singular);
+    if (std::isfinite(simpson_ratio)) {
+        res.meta["simpson_ratio"] = simpson_ratio;
+    }
+    res.meta["wall_time_s"] = elapsed();
+
+    return res;
+}
+
+std::string AutoSolver::decision_name(AutoDecision d) {
+    switch (d) {
+    case AutoDecision::GaussLegendre:        return "GaussLegendre";
+    case AutoDecision::Simpson:              return "CompositeSimpson";
+    case AutoDecision::AdaptiveGaussKronrod: return "AdaptiveGK";
+    case AutoDecision::MonteCarlo:           return "MonteCarloUniform";
+    }
+    return "Unknown";
+}
+
+} // namespace integ
@@ -1,5 +1,10 @@
 // CompositeSimpson.cpp
 #include "solvers/CompositeSimpson.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <stdexcept>
 
 namespace integ {
@@ -23,7 +28,14 @@ namespace integ {
  * - h = (b - a) / n
  * - x_i = a + i h
  *
- * No error estimate is provided.
+ * Interior points are summed in fixed chunks spread over p.n_threads
+ * threads and combined pairwise, so the value does not depend on the
+ * thread count.
+ *
+ * Interior nodes are accumulated by index modulo 4, which gives the
+ * coarser rules on the same nodes at no extra evaluation:
+ * - n divisible by 4: Simpson with step 2h, error |S_n - S_{n/2}| / 15;
+ * - otherwise: trapezoid with step h, error |S_n - T_n| (conservative).
  */
 IntegrationResult CompositeSimpsonSolver::integrate(
     const Function& f,
@@ -50,27 +62,138 @@ IntegrationResult CompositeSimpsonSolver::integrate(
     const std::size_t n = p.n;
     const double h = (b - a) / static_cast<double>(n);
 
+    const auto t0 = std::chrono::steady_clock::now();
+
     // Endpoints contribution
-    double sum = f(a) + f(b);
+    double ends_x[2] = { a, b };
+    double ends_y[2];
+    f.evaluate(ends_x, ends_y, 2);
 
-    // Odd indices (weight 4)
-    for (std::size_t i = 1; i < n; i += 2) {
-        const double x = a + h * static_cast<double>(i);
-        sum += 4.0 * f(x);
-    }
+    // Interior points 1..n-1, generated and evaluated block by block;
+    // s[r] accumulates the nodes with index i % 4 == r
+    auto partial = [&](std::size_t begin, std::size_t end) {
+        double xs[batch_size];
+        double ys[batch_size];
+        std::array<double, 4> s{};
+        for (std::size_t i0 = begin + 1; i0 < end + 1; i0 += batch_size) {
+            const std::size_t m = std::min(batch_size, end + 1 - i0);
+            for (std::size_t k = 0; k < m; ++k) {
+                xs[k] = a + h * static_cast<double>(i0 + k);
+            }
+            f.evaluate(xs, ys, m);
+            for (std::size_t k = 0; k < m; ++k) {
+                s[(i0 + k) % 4] += ys[k];
+            }
+        }
+        return s;
+    };
 
-    // Even indices (weight 2)
-    for (std::size_t i = 2; i < n; i += 2) {
-        const double x = a + h * static_cast<double>(i);
-        sum += 2.0 * f(x);
-    }
+    const auto s = chunked_sums<4>(n - 1, p.n_threads, partial);
+    const double ends = ends_y[0] + ends_y[1];
+
+    // Odd indices carry weight 4, even indices weight 2
+    const double value =
+        (h / 3.0) * (ends + 4.0 * (s[1] + s[3]) + 2.0 * (s[0] + s[2]));
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
 
     IntegrationResult res;
-    res.value = (h / 3.0) * sum;
+    res.value = value;
     res.evaluations = n + 1;   // a, b, and (n-1) interior points
     res.has_error_estimate = false;
 
+    // Embedded estimate from the already evaluated nodes
+    if (p.compute_error_estimate) {
+        res.has_error_estimate = true;
+        if (n % 4 == 0) {
+            // Simpson with step 2h uses the even nodes only
+            const double coarse =
+                (2.0 * h / 3.0) * (ends + 4.0 * s[2] + 2.0 * s[0]);
+            res.error_estimate = std::abs(value - coarse) / 15.0;
+        } else {
+            const double trap = h * (0.5 * ends + s[0] + s[1] + s[2] + s[3]);
+            res.error_estimate = std::abs(value - trap);
+        }
+    }
+    res.meta["threads"] = static_cast<double>(chunked_threads(n - 1, p.n_threads));
+    res.meta["wall_time_s"] = elapsed.count();
+
     return res;
 }
 
+/**
+ * @brief The rule has n + 1 nodes
+ */
+std::size_t CompositeSimpsonSolver::rule_size(
+    const Interval& /*I*/,
+    const SolverParams& p
+) const
+{
+    if (p.n < 2 || p.n % 2 != 0) {
+        throw std::invalid_argument(
+            "CompositeSimpson: n must be even and >= 2"
+        );
+    }
+    return p.n + 1;
+}
+
+/**
+ * @brief Nodes x_i = a + i h, weights h/3 * (1, 4, 2, 4, ..., 2, 4, 1)
+ */
+void CompositeSimpsonSolver::rule_nodes(
+    const Interval& I,
+    const SolverParams& p,
+    std::size_t begin,
+    std::size_t end,
+    double* x,
+    double* w
+) const
+{
+    const std::size_t n = rule_size(I, p) - 1;
+    const double h = I.length() / static_cast<double>(n);
+
+    for (std::size_t i = begin; i < end; ++i) {
+        x[i - begin] = (i == n) ? I.b() : I.a() + h * static_cast<double>(i);
+        const double c = (i == 0 || i == n) ? 1.0 : (i % 2 != 0 ? 4.0 : 2.0);
+        w[i - begin] = c * h / 3.0;
+    }
+}
+
+/**
+ * @brief Weights of the estimate used by integrate()
+ *
+ * (S_n - S_{n/2}) / 15 when 4 divides n, i.e. h / 45 times -1 at the
+ * ends, 4 at odd nodes, -6 at nodes 2 mod 4 and -2 at the other even
+ * nodes; S_n - T_n otherwise, i.e. h / 6 * (-1, 2, -2, 2, ..., 2, -1).
+ */
+bool CompositeSimpsonSolver::rule_error_weights(
+    const Interval& I,
+    const SolverParams& p,
+    std::size_t begin,
+    std::size_t end,
+    double* e
+) const
+{
+    const std::size_t n = rule_size(I, p) - 1;
+    const double h = I.length() / static_cast<double>(n);
+
+    for (std::size_t i = begin; i < end; ++i) {
+        // Weights in units of h / 3
+        const double fine = (i == 0 || i == n) ? 1.0 : (i % 2 != 0 ? 4.0 : 2.0);
+        if (n % 4 == 0) {
+            // Simpson with step 2h on the even nodes
+            const double coarse = (i == 0 || i == n) ? 2.0
+                                : (i % 2 != 0) ? 0.0
+                                : (i % 4 == 2) ? 8.0 : 4.0;
+            e[i - begin] = (fine - coarse) * h / 45.0;
+        } else {
+            // Trapezoid with step h
+            const double coarse = (i == 0 || i == n) ? 1.5 : 3.0;
+            e[i - begin] = (fine - coarse) * h / 3.0;
+        }
+    }
+    return true;
+}
+
 } // namespace integ
\ No newline at end of file
@@ -1,58 +1,248 @@
 // GSLIntegrator.cpp
 #include "solvers/GSLIntegrator.hpp"
+#include <gsl/gsl_errno.h>
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <stdexcept>
 
 namespace integ {
 
+namespace {
+
+/// CQUAD workspace intervals (the GSL manual deems 100 enough in most cases)
+constexpr std::size_t cquad_workspace_size = 100;
+
+/**
+ * @brief Remove and return the first pooled workspace with capacity >= size
+ * @return nullptr if no pooled workspace is large enough
+ */
+template <class Workspace, class Capacity>
+Workspace* take_from_pool(std::vector<Workspace*>& pool, std::size_t size,
+                          Capacity capacity)
+{
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        if (capacity(*pool[i]) >= size) {
+            Workspace* w = pool[i];
+            pool[i] = pool.back();
+            pool.pop_back();
+            return w;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief gsl_function payload: the integrand and an evaluation counter
+ */
+struct CountingFunction {
+    const Function& f;
+    std::size_t count = 0;
+};
+
+} // namespace
+
 /**
  * @brief Default constructor
  */
-GSLIntegrator::GSLIntegrator() = default;
+GSLIntegrator::GSLIntegrator() {
+    disable_gsl_error_handler();
+}
+
+/**
+ * @brief Process-wide, one-time gsl_set_error_handler_off()
+ */
+void GSLIntegrator::disable_gsl_error_handler() {
+    static std::once_flag once;
+    std::call_once(once, [] { gsl_set_error_handler_off(); });
+}
+
+/**
+ * @brief Destructor: release every pooled workspace
+ */
+GSLIntegrator::~GSLIntegrator() {
+    for (auto* w : pool_) {
+        gsl_integration_workspace_free(w);
+    }
+    for (auto* w : cquad_pool_) {
+        gsl_integration_cquad_workspace_free(w);
+    }
+}
+
+/**
+ * @brief Take the first pooled workspace holding at least `size` intervals
+ *
+ * Falls back to a fresh allocation (a pool miss) when none fits.
+ */
+gsl_integration_workspace* GSLIntegrator::acquire_workspace(std::size_t size) const {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        auto* w = take_from_pool(pool_, size,
+            [](const gsl_integration_workspace& ws) { return ws.limit; });
+        if (w) {
+            ++hits_;
+            return w;
+        }
+    }
+
+    ++misses_;
+    gsl_integration_workspace* w = gsl_integration_workspace_alloc(size);
+    if (!w) {
+        throw std::bad_alloc();
+    }
+    return w;
+}
 
 /**
- * @brief Integrate a function using GSL adaptive integration (QAGS)
+ * @brief Give a workspace back to the pool
+ */
+void GSLIntegrator::release_workspace(gsl_integration_workspace* w) const {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    pool_.push_back(w);
+}
+
+/**
+ * @brief Take a pooled CQUAD workspace holding at least `size` intervals
+ */
+gsl_integration_cquad_workspace* GSLIntegrator::acquire_cquad_workspace(std::size_t size) const {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        auto* w = take_from_pool(cquad_pool_, size,
+            [](const gsl_integration_cquad_workspace& ws) { return ws.size; });
+        if (w) {
+            ++hits_;
+            return w;
+        }
+    }
+
+    ++misses_;
+    gsl_integration_cquad_workspace* w = gsl_integration_cquad_workspace_alloc(size);
+    if (!w) {
+        throw std::bad_alloc();
+    }
+    return w;
+}
+
+/**
+ * @brief Give a CQUAD workspace back to the pool
+ */
+void GSLIntegrator::release_cquad_workspace(gsl_integration_cquad_workspace* w) const {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    cquad_pool_.push_back(w);
+}
+
+/**
+ * @brief Integrate a function with the GSL routine selected by p.gsl_method
+ *
+ * - QNG:   non-adaptive Gauss–Kronrod, no workspace
+ * - QAG:   adaptive Gauss–Kronrod, rule chosen by p.gsl_key
+ * - QAGS:  adaptive Gauss–Kronrod with epsilon-algorithm extrapolation
+ * - CQUAD: doubly-adaptive Clenshaw–Curtis
  *
- * Uses GSL's `gsl_integration_qags`, which applies adaptive
- * Gauss–Kronrod quadrature on the interval.
+ * Tolerances come from p.abs_tol / p.rel_tol and the subdivision limit
+ * from p.max_subdivisions. QAG/QAGS workspaces (at least
+ * max(p.gsl_workspace_size, p.max_subdivisions) intervals) and CQUAD
+ * workspaces (min(p.gsl_workspace_size, 100) intervals, at least 3) are
+ * borrowed from the integrator's pool.
  *
- * Absolute and relative tolerances are fixed to 1e-8.
+ * Every call to the integrand goes through a counting trampoline, so
+ * `evaluations` is the real number of f(x) calls. meta["gsl_status"]
+ * holds the GSL return code and success is false unless it is
+ * GSL_SUCCESS (e.g. tolerance not reached within max_subdivisions);
+ * value and error_estimate are then GSL's best effort. meta["intervals"]
+ * is the number of subintervals used by QAG/QAGS.
  */
 IntegrationResult GSLIntegrator::integrate(
     const Function& f,
     const Interval& I,
-    const SolverParams& /*p*/
+    const SolverParams& p
 ) const
 {
-    // Allocate GSL workspace
-    gsl_integration_workspace* w =
-        gsl_integration_workspace_alloc(1000);
+    if (p.max_subdivisions == 0) {
+        throw std::invalid_argument(
+            "GSLIntegrator: max_subdivisions must be >= 1"
+        );
+    }
+    if (p.gsl_method == GSLMethod::QAG && (p.gsl_key < 1 || p.gsl_key > 6)) {
+        throw std::invalid_argument(
+            "GSLIntegrator: gsl_key must be in 1..6"
+        );
+    }
 
-    // Wrap integ::Function into gsl_function
+    const std::size_t ws_size = std::max(p.gsl_workspace_size, p.max_subdivisions);
+    // CQUAD keeps its own small interval heap; max_subdivisions does not apply
+    const std::size_t cquad_size = std::max<std::size_t>(3,
+        std::min(p.gsl_workspace_size, cquad_workspace_size));
+
+    // Wrap integ::Function into gsl_function, counting the calls
+    CountingFunction payload{f};
     gsl_function F;
     F.function = [](double x, void* params) -> double {
-        return (*static_cast<const Function*>(params))(x);
+        auto* cf = static_cast<CountingFunction*>(params);
+        ++cf->count;
+        return cf->f(x);
     };
-    F.params = const_cast<Function*>(&f);
+    F.params = &payload;
 
     double result = 0.0;
     double error  = 0.0;
+    int status = GSL_SUCCESS;
+    std::size_t intervals = 0;
+
+    switch (p.gsl_method) {
+    case GSLMethod::QNG: {
+        std::size_t neval = 0;
+        status = gsl_integration_qng(&F, I.a(), I.b(),
+            p.abs_tol, p.rel_tol, &result, &error, &neval);
+        break;
+    }
+    case GSLMethod::QAG:
+    case GSLMethod::QAGS: {
+        // Borrow a GSL workspace for the duration of the call
+        struct Lease {
+            const GSLIntegrator& owner;
+            gsl_integration_workspace* w;
+            ~Lease() { owner.release_workspace(w); }
+        } lease{*this, acquire_workspace(ws_size)};
 
-    // Adaptive integration
-    gsl_integration_qags(&F, I.a(), I.b(),
-        1e-8,   // absolute tolerance
-        1e-8,   // relative tolerance
-        1000,   // max subintervals
-        w, &result, &error
-    );
+        if (p.gsl_method == GSLMethod::QAG) {
+            status = gsl_integration_qag(&F, I.a(), I.b(),
+                p.abs_tol, p.rel_tol, p.max_subdivisions, p.gsl_key,
+                lease.w, &result, &error);
+        } else {
+            status = gsl_integration_qags(&F, I.a(), I.b(),
+                p.abs_tol, p.rel_tol, p.max_subdivisions,
+                lease.w, &result, &error);
+        }
+        intervals = lease.w->size;
+        break;
+    }
+    case GSLMethod::CQUAD: {
+        struct Lease {
+            const GSLIntegrator& owner;
+            gsl_integration_cquad_workspace* w;
+            ~Lease() { owner.release_cquad_workspace(w); }
+        } lease{*this, acquire_cquad_workspace(cquad_size)};
 
-    gsl_integration_workspace_free(w);
+        std::size_t neval = 0;
+        status = gsl_integration_cquad(&F, I.a(), I.b(),
+            p.abs_tol, p.rel_tol, lease.w, &result, &error, &neval);
+        break;
+    }
+    }
 
     IntegrationResult r;
     r.value = result;
-    r.evaluations = 1000;
+    r.evaluations = payload.count;
     r.has_error_estimate = true;
     r.error_estimate = error;
+    r.success = (status == GSL_SUCCESS);
+    r.meta["gsl_status"] = static_cast<double>(status);
+    if (intervals > 0) {
+        r.meta["intervals"] = static_cast<double>(intervals);
+    }
 
     return r;
 }
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
@@ -1,73 +1,94 @@
 // GaussLegendre.cpp
 #include "solvers/GaussLegendre.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
+#include <vector>
 
 namespace integ {
 
 /**
  * @brief Construct a Gauss–Legendre solver
  *
- * @param order Quadrature order (2, 3, or 5)
+ * @param order Quadrature order (number of points)
+ * @param composite Apply the rule on p.n panels
  */
-GaussLegendreSolver::GaussLegendreSolver(std::size_t order)
-    : order_(order)
+GaussLegendreSolver::GaussLegendreSolver(std::size_t order, bool composite)
+    : order_(order), rule_(&gauss_legendre_rule(order)), composite_(composite)
+{}
+
+/**
+ * @brief Solver name including quadrature order
+ */
+std::string GaussLegendreSolver::name() const {
+    return std::string(composite_ ? "CompositeGaussLegendre" : "GaussLegendre")
+         + "(order=" + std::to_string(order_) + ")";
+}
+
+/**
+ * @brief m nodes, or n * m in composite mode
+ */
+std::size_t GaussLegendreSolver::rule_size(
+    const Interval& /*I*/,
+    const SolverParams& p
+) const
 {
-    if (!(order_ == 2 || order_ == 3 || order_ == 5)) {
+    if (!composite_) return order_;
+    if (p.n == 0) {
         throw std::invalid_argument(
-            "GaussLegendre: order must be 2, 3, or 5"
+            "CompositeGaussLegendre: n must be >= 1"
         );
     }
+    return p.n * order_;
 }
 
 /**
- * @brief Solver name including quadrature order
+ * @brief Mapped nodes and scaled weights, panel-major in composite mode
  */
-std::string GaussLegendreSolver::name() const {
-    return "GaussLegendre(order=" + std::to_string(order_) + ")";
+void GaussLegendreSolver::rule_nodes(
+    const Interval& I,
+    const SolverParams& p,
+    std::size_t begin,
+    std::size_t end,
+    double* x,
+    double* w
+) const
+{
+    const std::size_t panels = rule_size(I, p) / order_;
+    const double H = I.length() / static_cast<double>(panels);
+    const double half = 0.5 * H;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::size_t j = i / order_;
+        const std::size_t k = i % order_;
+        const double mid = I.a() + H * (static_cast<double>(j) + 0.5);
+        x[i - begin] = mid + half * rule_->nodes[k];
+        w[i - begin] = half * rule_->weights[k];
+    }
 }
 
 /**
  * @brief Integrate using Gauss–Legendre quadrature
  *
- * Uses fixed nodes and weights on [-1,1], mapped
- * affinely to the interval [a,b].
+ * Uses the cached nodes and weights on [-1,1], mapped
+ * affinely to the interval [a,b] (or to each panel in composite mode).
  *
  * No error estimate is provided.
  */
 IntegrationResult GaussLegendreSolver::integrate(
     const Function& f,
     const Interval& I,
-    const SolverParams& /*p*/
+    const SolverParams& p
 ) const
 {
-    // Nodes and weights on [-1,1]
-    const double* x = nullptr;
-    const double* w = nullptr;
-    std::size_t m = 0;
-
-    static const double x2[] = { -0.5773502691896257,  0.5773502691896257 };
-    static const double w2[] = {  1.0,                 1.0 };
-
-    static const double x3[] = {
-        -0.7745966692414834, 0.0, 0.7745966692414834
-    };
-    static const double w3[] = {
-         0.5555555555555556, 0.8888888888888888, 0.5555555555555556
-    };
-
-    static const double x5[] = {
-        -0.9061798459386640, -0.5384693101056831, 0.0,
-         0.5384693101056831,  0.9061798459386640
-    };
-    static const double w5[] = {
-         0.2369268850561891, 0.4786286704993665, 0.5688888888888889,
-         0.4786286704993665, 0.2369268850561891
-    };
+    if (composite_) {
+        return integrate_composite(f, I, p);
+    }
 
-    // Select rule
-    if (order_ == 2)      { x = x2; w = w2; m = 2; }
-    else if (order_ == 3) { x = x3; w = w3; m = 3; }
-    else                  { x = x5; w = w5; m = 5; }
+    const double* x = rule_->nodes.data();
+    const double* w = rule_->weights.data();
+    const std::size_t m = order_;
 
     const double a = I.a();
     const double b = I.b();
@@ -76,10 +97,19 @@ IntegrationResult GaussLegendreSolver::integrate(
     const double mid  = 0.5 * (a + b);
     const double half = 0.5 * (b - a);
 
+    // Map a block of nodes, then evaluate it in one batch call
+    double u[batch_size];
+    double fu[batch_size];
     double sum = 0.0;
-    for (std::size_t i = 0; i < m; ++i) {
-        const double u = mid + half * x[i];
-        sum += w[i] * f(u);
+    for (std::size_t i0 = 0; i0 < m; i0 += batch_size) {
+        const std::size_t k_end = std::min(batch_size, m - i0);
+        for (std::size_t k = 0; k < k_end; ++k) {
+            u[k] = mid + half * x[i0 + k];
+        }
+        f.evaluate(u, fu, k_end);
+        for (std::size_t k = 0; k < k_end; ++k) {
+            sum += w[i0 + k] * fu[k];
+        }
     }
 
     IntegrationResult res;
@@ -90,4 +120,85 @@ IntegrationResult GaussLegendreSolver::integrate(
     return res;
 }
 
-} // namespace integ
\ No newline at end of file
+/**
+ * @brief Composite Gauss–Legendre rule over n equal panels
+ *
+ * \f[
+ * \int_a^b f(x)\,dx \approx \frac{H}{2} \sum_{j=0}^{n-1} \sum_{k=0}^{m-1}
+ * w_k\, f\!\left(a + (j + \tfrac12) H + \tfrac{H}{2} x_k\right),
+ * \quad H = \frac{b - a}{n}
+ * \f]
+ *
+ * Nodes of consecutive panels are laid out contiguously in one block
+ * (panel-major) and evaluated with a single batch call per block.
+ * Panels are summed in fixed chunks over p.n_threads threads and
+ * combined pairwise, so the value does not depend on the thread count.
+ */
+IntegrationResult GaussLegendreSolver::integrate_composite(
+    const Function& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    if (p.n == 0) {
+        throw std::invalid_argument(
+            "CompositeGaussLegendre: n must be >= 1"
+        );
+    }
+
+    const double* x = rule_->nodes.data();
+    const double* w = rule_->weights.data();
+    const std::size_t m = order_;
+    const std::size_t n = p.n;
+
+    const double a = I.a();
+    const double H = I.length() / static_cast<double>(n);
+    const double half = 0.5 * H;
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // Panels per evaluation block and per reduction chunk
+    const std::size_t block_panels = std::max<std::size_t>(1, batch_size / m);
+    const std::size_t chunk_panels = std::max<std::size_t>(1, reduction_chunk / m);
+
+    auto partial = [&](std::size_t begin, std::size_t end) -> double {
+        std::vector<double> xs(block_panels * m);
+        std::vector<double> ys(block_panels * m);
+        double s = 0.0;
+
+        for (std::size_t j0 = begin; j0 < end; j0 += block_panels) {
+            const std::size_t np = std::min(block_panels, end - j0);
+
+            for (std::size_t j = 0; j < np; ++j) {
+                const double mid = a + H * (static_cast<double>(j0 + j) + 0.5);
+                for (std::size_t k = 0; k < m; ++k) {
+                    xs[j * m + k] = mid + half * x[k];
+                }
+            }
+            f.evaluate(xs.data(), ys.data(), np * m);
+
+            for (std::size_t j = 0; j < np; ++j) {
+                for (std::size_t k = 0; k < m; ++k) {
+                    s += w[k] * ys[j * m + k];
+                }
+            }
+        }
+        return s;
+    };
+
+    const double sum = chunked_sum(n, p.n_threads, partial, chunk_panels);
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
+
+    IntegrationResult res;
+    res.value = half * sum;
+    res.evaluations = n * m;
+    res.has_error_estimate = false;
+    res.meta["threads"] = static_cast<double>(chunked_threads(n, p.n_threads, chunk_panels));
+    res.meta["wall_time_s"] = elapsed.count();
+
+    return res;
+}
+
+} // namespace integ
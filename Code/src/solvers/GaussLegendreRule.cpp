@@ -0,0 +1,99 @@
+// GaussLegendreRule.cpp
+#include "solvers/GaussLegendreRule.hpp"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace integ {
+
+namespace {
+
+/**
+ * @brief Compute the m-point rule by Newton iteration on P_m
+ *
+ * Starting guess for the i-th positive root (Tricomi):
+ *   z_i = cos(pi (i + 3/4) / (m + 1/2)).
+ * P_m and P_{m-1} come from the three-term recurrence
+ *   j P_j(z) = (2j - 1) z P_{j-1}(z) - (j - 1) P_{j-2}(z),
+ * the derivative from
+ *   P_m'(z) = m (z P_m(z) - P_{m-1}(z)) / (z^2 - 1),
+ * and the weights are w_i = 2 / ((1 - z_i^2) P_m'(z_i)^2).
+ * Newton stops once the step is below eps |z|, or stops shrinking
+ * (rounding level, e.g. for the root near 0 of an odd rule).
+ */
+std::unique_ptr<GaussLegendreRule> compute_rule(std::size_t m) {
+    const double pi = 3.14159265358979323846;
+    const double md = static_cast<double>(m);
+    const double step_tol = std::numeric_limits<double>::epsilon();
+
+    auto rule = std::make_unique<GaussLegendreRule>();
+    rule->nodes.resize(m);
+    rule->weights.resize(m);
+
+    for (std::size_t i = 0; i < (m + 1) / 2; ++i) {
+        double z = std::cos(pi * (static_cast<double>(i) + 0.75) / (md + 0.5));
+        double dp = 0.0;
+        double prev_step = std::numeric_limits<double>::infinity();
+
+        for (int it = 0; it < 100; ++it) {
+            double p0 = 1.0;
+            double p1 = z;
+            for (std::size_t j = 2; j <= m; ++j) {
+                const double jd = static_cast<double>(j);
+                const double p2 = ((2.0 * jd - 1.0) * z * p1 - (jd - 1.0) * p0) / jd;
+                p0 = p1;
+                p1 = p2;
+            }
+            // p1 = P_m(z), p0 = P_{m-1}(z)
+            dp = md * (z * p1 - p0) / (z * z - 1.0);
+
+            const double dz = p1 / dp;
+            z -= dz;
+            const double step = std::abs(dz);
+            if (step <= step_tol * std::abs(z) || step >= prev_step) break;
+            prev_step = step;
+        }
+
+        // Middle node of an odd rule is exactly 0 by symmetry
+        if (m % 2 == 1 && i == m / 2) z = 0.0;
+
+        const double w = 2.0 / ((1.0 - z * z) * dp * dp);
+        rule->nodes[i] = -z;
+        rule->nodes[m - 1 - i] = z;
+        rule->weights[i] = w;
+        rule->weights[m - 1 - i] = w;
+    }
+
+    return rule;
+}
+
+} // namespace
+
+/**
+ * @brief Cached Gauss–Legendre rule lookup
+ */
+const GaussLegendreRule& gauss_legendre_rule(std::size_t order) {
+    if (order == 0 || order > max_gauss_legendre_order) {
+        throw std::invalid_argument(
+            "GaussLegendre: order must be in 1.." +
+            std::to_string(max_gauss_legendre_order)
+        );
+    }
+
+    static std::mutex cache_mutex;
+    static std::map<std::size_t, std::unique_ptr<GaussLegendreRule>> cache;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto& slot = cache[order];
+    if (!slot) {
+        slot = compute_rule(order);
+    }
+    return *slot;
+}
+
+} // namespace integ
@@ -1,11 +1,39 @@
 // MonteCarloUniform.cpp
 #include "solvers/MonteCarloUniform.hpp"
-#include <random>
+#include "core/Parallel.hpp"
+#include "core/Philox.hpp"
+#include "core/RunningStats.hpp"
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
 #include <cmath>
+#include <vector>
 
 namespace integ {
 
+namespace {
+
+/// Statistics of one chunk of sampling units
+struct ChunkStats {
+    RunningStats f;            ///< Raw integrand values
+    RunningStats g;            ///< Per-unit estimates (Antithetic, Importance)
+    double strata_mean = 0.0;  ///< Sum of stratum means (Stratified)
+    double strata_var = 0.0;   ///< Sum of stratum variances (Stratified)
+    double w = 0.0;            ///< Sum of importance weights
+    double w2 = 0.0;           ///< Sum of squared importance weights
+
+    void merge(const ChunkStats& o) {
+        f.merge(o.f);
+        g.merge(o.g);
+        strata_mean += o.strata_mean;
+        strata_var += o.strata_var;
+        w += o.w;
+        w2 += o.w2;
+    }
+};
+
+} // namespace
+
 /**
  * @brief Monte Carlo integration with uniform sampling
  *
@@ -15,8 +43,25 @@ namespace integ {
  * \quad X_i \sim \mathcal{U}(a,b)
  * \]
  *
- * Uses Welford's algorithm for numerically stable
- * mean and variance estimation.
+ * p.variance_reduction selects the estimator:
+ * - Antithetic: n/2 pairs, each averaging f(X) and f(a + b - X);
+ * - Stratified: p.n strata of width (b-a)/p.n with n/p.n samples each,
+ *   \f$\hat I = \frac{b-a}{K}\sum_k \bar f_k\f$;
+ * - Importance: \f$X_i = Q^{-1}(U_i)\f$ with density q,
+ *   \f$\hat I = \frac{1}{n}\sum_i f(X_i)/q(X_i)\f$.
+ *
+ * Samples come from a Philox4x32 counter-based generator keyed by
+ * p.seed: sample i depends only on (seed, i). The sampling units
+ * (samples, pairs or strata) are cut into fixed chunks run on
+ * p.n_threads threads, each with its own Welford accumulators; the
+ * accumulators are merged in chunk order with Chan's parallel formula.
+ * For a given seed the result is therefore identical whatever the
+ * thread count.
+ *
+ * meta["variance"] is the estimated variance of the estimator and
+ * meta["ess"] the effective sample size: the number of plain uniform
+ * samples giving the same variance (Kish's (Σw)²/Σw² for importance
+ * sampling).
  */
 IntegrationResult MonteCarloUniformSolver::integrate(
     const Function& f,
@@ -30,63 +75,226 @@ IntegrationResult MonteCarloUniformSolver::integrate(
         );
     }
 
+    const VarianceReduction mode = p.variance_reduction;
     const double a = I.a();
-    const double b = I.b();
     const double L = I.length();
     const std::size_t n = p.n_samples;
 
-    // Random number generator
-    std::mt19937 rng;
-    if (p.seed.has_value()) {
-        rng.seed(*p.seed);
-    } else {
-        rng.seed(std::random_device{}());
+    // Sampling units and samples per unit
+    std::size_t units = n;
+    std::size_t per_unit = 1;
+    if (mode == VarianceReduction::Antithetic) {
+        if (n < 2) {
+            throw std::invalid_argument(
+                "MonteCarloUniform: antithetic sampling needs n_samples >= 2"
+            );
+        }
+        units = n / 2;
+        per_unit = 2;
+    } else if (mode == VarianceReduction::Stratified) {
+        if (p.n == 0 || p.n > n) {
+            throw std::invalid_argument(
+                "MonteCarloUniform: stratified sampling needs 1 <= n <= n_samples"
+            );
+        }
+        units = p.n;
+        per_unit = n / p.n;
+    } else if (mode == VarianceReduction::Importance) {
+        if (!p.importance_density || !p.importance_inverse_cdf) {
+            throw std::invalid_argument(
+                "MonteCarloUniform: importance sampling needs importance_density and importance_inverse_cdf"
+            );
+        }
     }
+    const std::size_t n_eval = units * per_unit;
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // Counter-based generator: sample i is a pure function of (seed, i)
+    const std::uint64_t seed = p.seed.has_value() ? *p.seed : fresh_seed();
+    const Philox4x32 rng(seed);
+
+    // One set of accumulators per fixed-size chunk of units
+    const std::size_t chunk = std::max<std::size_t>(1, reduction_chunk / per_unit);
+    const std::size_t n_chunks = (units + chunk - 1) / chunk;
+    std::vector<ChunkStats> chunk_stats(n_chunks);
+
+    parallel_for(n_chunks, p.n_threads, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t end = std::min(units, begin + chunk);
+
+        double us[batch_size];
+        double xs[batch_size];
+        double ys[batch_size];
+        ChunkStats& st = chunk_stats[c];
 
-    std::uniform_real_distribution<double> unif(a, b);
+        switch (mode) {
+        case VarianceReduction::None:
+            for (std::size_t i0 = begin; i0 < end; i0 += batch_size) {
+                const std::size_t m = std::min(batch_size, end - i0);
 
-    // Welford's algorithm for mean and variance
-    double mean = 0.0;
-    double m2 = 0.0;
+                // Draw a block of samples, then evaluate it in one call
+                rng.fill_uniform(i0, xs, m);
+                for (std::size_t k = 0; k < m; ++k) {
+                    xs[k] = a + L * xs[k];
+                }
+                f.evaluate(xs, ys, m);
 
-    for (std::size_t i = 1; i <= n; ++i) {
-        const double x = unif(rng);
-        const double y = f(x);
+                for (std::size_t k = 0; k < m; ++k) {
+                    st.f.add(ys[k]);
+                }
+            }
+            break;
 
-        const double delta = y - mean;
-        mean += delta / static_cast<double>(i);
-        const double delta2 = y - mean;
-        m2 += delta * delta2;
+        case VarianceReduction::Antithetic:
+            for (std::size_t i0 = begin; i0 < end; i0 += batch_size / 2) {
+                const std::size_t m = std::min(batch_size / 2, end - i0);
+
+                // xs = [X_0..X_m, a+b-X_0..a+b-X_m]
+                rng.fill_uniform(i0, us, m);
+                for (std::size_t k = 0; k < m; ++k) {
+                    xs[k] = a + L * us[k];
+                    xs[m + k] = a + L * (1.0 - us[k]);
+                }
+                f.evaluate(xs, ys, 2 * m);
+
+                for (std::size_t k = 0; k < m; ++k) {
+                    st.f.add(ys[k]);
+                    st.f.add(ys[m + k]);
+                    st.g.add(L * 0.5 * (ys[k] + ys[m + k]));
+                }
+            }
+            break;
+
+        case VarianceReduction::Stratified: {
+            const double h = L / static_cast<double>(units);
+            for (std::size_t s = begin; s < end; ++s) {
+                const double lo = a + h * static_cast<double>(s);
+                RunningStats stratum;
+                for (std::size_t j0 = 0; j0 < per_unit; j0 += batch_size) {
+                    const std::size_t m = std::min(batch_size, per_unit - j0);
+                    rng.fill_uniform(s * per_unit + j0, xs, m);
+                    for (std::size_t k = 0; k < m; ++k) {
+                        xs[k] = lo + h * xs[k];
+                    }
+                    f.evaluate(xs, ys, m);
+
+                    for (std::size_t k = 0; k < m; ++k) {
+                        stratum.add(ys[k]);
+                        st.f.add(ys[k]);
+                    }
+                }
+                st.strata_mean += stratum.mean;
+                st.strata_var += stratum.variance();
+            }
+            break;
+        }
+
+        case VarianceReduction::Importance: {
+            double qs[batch_size];
+            for (std::size_t i0 = begin; i0 < end; i0 += batch_size) {
+                const std::size_t m = std::min(batch_size, end - i0);
+
+                // X = Q^{-1}(U), then q(X) and f(X)
+                rng.fill_uniform(i0, us, m);
+                p.importance_inverse_cdf->evaluate(us, xs, m);
+                p.importance_density->evaluate(xs, qs, m);
+                f.evaluate(xs, ys, m);
+
+                for (std::size_t k = 0; k < m; ++k) {
+                    if (!(qs[k] > 0.0)) {
+                        throw std::invalid_argument(
+                            "MonteCarloUniform: importance density must be > 0 at sampled points"
+                        );
+                    }
+                    const double w = 1.0 / (L * qs[k]);
+                    st.f.add(ys[k]);
+                    st.g.add(ys[k] / qs[k]);
+                    st.w += w;
+                    st.w2 += w * w;
+                }
+            }
+            break;
+        }
+        }
+    });
+
+    // Merge chunk accumulators in chunk order (Chan's formula)
+    ChunkStats stats;
+    for (const auto& st : chunk_stats) {
+        stats.merge(st);
     }
 
-    const double var_f =
-        (n > 1) ? (m2 / static_cast<double>(n - 1)) : 0.0;
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
+
+    const double var_f = stats.f.variance();
 
-    const double estimate = L * mean;
+    // Estimate and variance of the estimator
+    double estimate = 0.0;
+    double variance = 0.0;
+    bool has_variance = false;
+    switch (mode) {
+    case VarianceReduction::None:
+        estimate = L * stats.f.mean;
+        variance = L * L * var_f / static_cast<double>(n_eval);
+        has_variance = n_eval > 1;
+        break;
+    case VarianceReduction::Antithetic:
+    case VarianceReduction::Importance:
+        estimate = stats.g.mean;
+        variance = stats.g.variance() / static_cast<double>(units);
+        has_variance = units > 1;
+        break;
+    case VarianceReduction::Stratified: {
+        const double hk = L / static_cast<double>(units);
+        estimate = hk * stats.strata_mean;
+        variance = hk * hk * stats.strata_var / static_cast<double>(per_unit);
+        has_variance = per_unit > 1;
+        break;
+    }
+    }
 
     IntegrationResult res;
     res.value = estimate;
-    res.evaluations = n;
+    res.evaluations = n_eval;
 
     /**
      * Standard error:
      * \[
-     * \sigma_{\hat I} = (b-a)\sqrt{\frac{\mathrm{Var}(f)}{n}}
+     * \sigma_{\hat I} = \sqrt{\mathrm{Var}(\hat I)},\qquad
+     * \mathrm{Var}(\hat I) = (b-a)^2\,\frac{\mathrm{Var}(f)}{n}
+     * \text{ for plain sampling}
      * \]
      */
-    if (p.compute_error_estimate && n > 1) {
+    if (p.compute_error_estimate && has_variance) {
         res.has_error_estimate = true;
-        res.error_estimate =
-            L * std::sqrt(var_f / static_cast<double>(n));
-        res.meta["var_f"] = var_f;
+        res.error_estimate = std::sqrt(variance);
+        res.meta["variance"] = variance;
+        if (mode == VarianceReduction::None) {
+            res.meta["var_f"] = var_f;
+        }
+
+        double ess = static_cast<double>(n_eval);
+        if (mode == VarianceReduction::Importance) {
+            ess = (stats.w2 > 0.0) ? stats.w * stats.w / stats.w2 : 0.0;
+        } else if (mode != VarianceReduction::None && variance > 0.0) {
+            ess = L * L * var_f / variance;
+        }
+        res.meta["ess"] = ess;
     }
 
     // Store seed if explicitly provided (for reproducibility)
     if (p.seed.has_value()) {
         res.meta["seed"] = static_cast<double>(*p.seed);
     }
+    if (mode == VarianceReduction::Stratified) {
+        res.meta["strata"] = static_cast<double>(units);
+    }
+    res.meta["threads"] = static_cast<double>(threads_used(n_chunks, p.n_threads));
+    res.meta["wall_time_s"] = elapsed.count();
 
     return res;
 }
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
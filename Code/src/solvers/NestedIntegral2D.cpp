@@ -3,9 +3,41 @@
 
 #include "core/Function.hpp"
 #include "core/Interval.hpp"
+#include "core/Parallel.hpp"
+#include "solvers/TensorProduct2D.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 namespace integ {
 
+namespace {
+
+/**
+ * @brief f(x, y) as a 1D function in y for a fixed x
+ *
+ * Batch calls from the inner solver map to Function2D::evaluate_y.
+ */
+class Fy final : public Function {
+public:
+    Fy(const Function2D& f, double x) : f_(f), x_(x) {}
+    double operator()(double y) const override {
+        return f_(x_, y);
+    }
+    void evaluate(const double* y, double* out, std::size_t n) const override {
+        f_.evaluate_y(x_, y, out, n);
+    }
+private:
+    const Function2D& f_;
+    double x_;
+};
+
+} // namespace
+
 /**
  * @brief Construct a nested 2D integrator
  */
@@ -21,6 +53,33 @@ NestedIntegral2D::NestedIntegral2D(
  *
  * Performs:
  *   int_{x ∈ domain} [ int_{y_min(x)}^{y_max(x)} f(x, y) dy ] dx
+ *
+ * If the outer solver has a fixed rule, its nodes x_i and weights w_i
+ * are materialized and the inner integrals g(x_i) are computed as
+ * independent tasks on params.n_threads threads (each inner call runs
+ * single-threaded). Tasks are handed out one node at a time, so threads
+ * that get cheap inner integrals (short [y_min, y_max]) simply take
+ * more of them. The sum of w_i g(x_i) is reduced pairwise in node
+ * order, so the value does not depend on the thread count.
+ *
+ * Otherwise (adaptive or random outer solver) the outer solver is run
+ * on x -> g(x) directly.
+ *
+ * Rectangular domains where both solvers have a fixed rule are routed
+ * to TensorProduct2D, which evaluates the same grid in batched tiles
+ * and fills the same error estimate and meta keys.
+ *
+ * The result aggregates both levels:
+ * - evaluations: total number of f(x, y) calls over all inner integrals;
+ * - error_estimate: the outer solver's own estimate plus the inner
+ *   errors propagated through the outer rule, sum_i |w_i| e_i for a
+ *   fixed rule or (x_max - x_min) max_i e_i otherwise. For a fixed
+ *   rule the outer estimate is |sum_i e_i g(x_i)| with the error
+ *   weights of Solver::rule_error_weights (no new inner integral); if
+ *   the outer rule has none (e.g. Gauss–Legendre) only the inner part
+ *   is reported;
+ * - meta: "outer_nodes", "inner_calls", "total_f_calls",
+ *   "max_inner_error" and, when available, "outer_error".
  */
 IntegrationResult NestedIntegral2D::integrate(
     const Function2D& f,
@@ -28,40 +87,138 @@ IntegrationResult NestedIntegral2D::integrate(
     const SolverParams& params
 ) const
 {
+    // Rectangle with fixed rules: same grid, batched tensor product
+    const TensorProduct2D tensor(outer_, inner_);
+    if (tensor.supports(domain, params)) {
+        return tensor.integrate(f, domain, params);
+    }
+
+    SolverParams inner_params = params;
+    inner_params.n_threads = 1;
+
     // Inner integral over y for a fixed x
-    auto inner_integral = [&](double x) -> double {
+    auto inner_integral = [&](double x) -> IntegrationResult {
+        const double y0 = domain.y_min(x);
+        const double y1 = domain.y_max(x);
+        if (!std::isfinite(y0) || !std::isfinite(y1) || y1 < y0) {
+            throw std::invalid_argument(
+                "NestedIntegral2D: y bounds must be finite with y_min(x) <= y_max(x)"
+            );
+        }
+        if (y1 == y0) {
+            // Zero-width slice (e.g. the apex of a triangle)
+            IntegrationResult empty;
+            empty.has_error_estimate = true;
+            return empty;
+        }
+
+        Fy fy(f, x);
+        return inner_.integrate(fy, Interval(y0, y1), inner_params);
+    };
+
+    const Interval& Ix = domain.x_interval();
+    const std::size_t n_outer = outer_.rule_size(Ix, params);
+
+    IntegrationResult res;
+    std::size_t inner_calls = 0;
+    std::size_t f_calls = 0;
+    double max_inner_err = 0.0;
+    bool inner_has_err = true;
+
+    if (n_outer == 0) {
+        // Outer integrand: value of the inner integral; the outer solver
+        // may call it from several threads, hence the mutex
+        std::mutex stats_mutex;
+        auto g = [&](double x) -> double {
+            const IntegrationResult r = inner_integral(x);
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            ++inner_calls;
+            f_calls += r.evaluations;
+            inner_has_err = inner_has_err && r.has_error_estimate;
+            max_inner_err = std::max(max_inner_err, r.error_estimate);
+            return r.value;
+        };
 
-        // f(x, y) as a 1D function in y
-        class Fy : public Function {
+        class Fx : public Function {
         public:
-            Fy(const Function2D& f, double x) : f_(f), x_(x) {}
-            double operator()(double y) const override {
-                return f_(x_, y);
+            Fx(const decltype(g)& g) : g_(g) {}
+            double operator()(double x) const override {
+                return g_(x);
             }
         private:
-            const Function2D& f_;
-            double x_;
+            const decltype(g)& g_;
         };
 
-        Fy fy(f, x);
-        Interval Iy(domain.y_min(x), domain.y_max(x));
+        Fx fx(g);
+        res = outer_.integrate(fx, Ix, params);
 
-        return inner_.integrate(fy, Iy, params).value;
-    };
+        res.has_error_estimate = res.has_error_estimate && inner_has_err;
+        if (res.has_error_estimate) {
+            res.error_estimate += Ix.length() * max_inner_err;
+        }
+    } else {
+        const auto t0 = std::chrono::steady_clock::now();
+
+        // Materialize the outer rule
+        std::vector<double> xs(n_outer);
+        std::vector<double> ws(n_outer);
+        outer_.rule_nodes(Ix, params, 0, n_outer, xs.data(), ws.data());
 
-    // Outer integrand: result of the inner integral
-    class Fx : public Function {
-    public:
-        Fx(const decltype(inner_integral)& g) : g_(g) {}
-        double operator()(double x) const override {
-            return g_(x);
+        // One inner integral per outer node, dynamically scheduled
+        std::vector<double> gs(n_outer);
+        std::vector<double> terms(n_outer);
+        std::vector<double> errs(n_outer);
+        std::vector<std::size_t> evals(n_outer);
+        std::vector<char> has_err(n_outer);
+        parallel_for(n_outer, params.n_threads, [&](std::size_t i) {
+            const IntegrationResult r = inner_integral(xs[i]);
+            gs[i] = r.value;
+            terms[i] = ws[i] * r.value;
+            errs[i] = r.error_estimate;
+            evals[i] = r.evaluations;
+            has_err[i] = r.has_error_estimate;
+        });
+
+        // Per-level counters, then errors weighted by the outer rule
+        for (std::size_t i = 0; i < n_outer; ++i) {
+            f_calls += evals[i];
+            inner_has_err = inner_has_err && has_err[i];
+            max_inner_err = std::max(max_inner_err, errs[i]);
+            errs[i] *= std::abs(ws[i]);
         }
-    private:
-        const decltype(inner_integral)& g_;
-    };
+        inner_calls = n_outer;
+
+        res.value = pairwise_sum(terms.data(), n_outer);
+        if (params.compute_error_estimate && inner_has_err) {
+            res.has_error_estimate = true;
+            res.error_estimate = pairwise_sum(errs.data(), n_outer);
+
+            // Outer discretization error: embedded estimate of the outer
+            // rule applied to the stored g(x_i), node by node
+            std::vector<double> es(n_outer);
+            if (outer_.rule_error_weights(Ix, params, 0, n_outer, es.data())) {
+                for (std::size_t i = 0; i < n_outer; ++i) {
+                    es[i] *= gs[i];
+                }
+                const double outer_error = std::abs(pairwise_sum(es.data(), n_outer));
+                res.error_estimate += outer_error;
+                res.meta["outer_error"] = outer_error;
+            }
+        }
+
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - t0;
+        res.meta["threads"] = static_cast<double>(threads_used(n_outer, params.n_threads));
+        res.meta["wall_time_s"] = elapsed.count();
+    }
+
+    res.evaluations = f_calls;
+    res.meta["outer_nodes"] = static_cast<double>(n_outer > 0 ? n_outer : inner_calls);
+    res.meta["inner_calls"] = static_cast<double>(inner_calls);
+    res.meta["total_f_calls"] = static_cast<double>(f_calls);
+    res.meta["max_inner_error"] = max_inner_err;
 
-    Fx fx(inner_integral);
-    return outer_.integrate(fx, domain.x_interval(), params);
+    return res;
 }
 
-} // namespace integ
\ No newline at end of file
+} // namespace integ
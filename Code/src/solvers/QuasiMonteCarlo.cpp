@@ -0,0 +1,238 @@
+// QuasiMonteCarlo.cpp
+#include "solvers/QuasiMonteCarlo.hpp"
+#include "core/LowDiscrepancy.hpp"
+#include "core/Parallel.hpp"
+#include "core/Philox.hpp"
+#include "core/RunningStats.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace integ {
+
+namespace {
+
+const Sobol2D sobol_points;
+
+/// Randomization of one replicate (identity when not randomized)
+struct Shift {
+    std::uint32_t digital[2] = {0, 0}; ///< XOR masks (Sobol)
+    double offset[2] = {0.0, 0.0};     ///< Shifts modulo 1 (Halton)
+};
+
+/**
+ * @brief Unit-square points first..first+m-1 of one replicate
+ *
+ * Sobol coordinates are taken at the centre of their 2^-32 cell, so
+ * points never land on the boundary of [0, 1].
+ */
+void fill_points(QMCSequence seq, const Shift& s, std::uint64_t first,
+                 std::size_t m, double* u0, double* u1)
+{
+    if (seq == QMCSequence::Sobol) {
+        std::uint32_t a[batch_size];
+        std::uint32_t b[batch_size];
+        sobol_points.fill(first, m, a, u1 ? b : nullptr);
+        for (std::size_t k = 0; k < m; ++k) {
+            u0[k] = (static_cast<double>(a[k] ^ s.digital[0]) + 0.5) * 0x1.0p-32;
+        }
+        if (u1) {
+            for (std::size_t k = 0; k < m; ++k) {
+                u1[k] = (static_cast<double>(b[k] ^ s.digital[1]) + 0.5) * 0x1.0p-32;
+            }
+        }
+    } else {
+        for (std::size_t k = 0; k < m; ++k) {
+            const double h = radical_inverse(2, first + k) + s.offset[0];
+            u0[k] = h - std::floor(h);
+        }
+        if (u1) {
+            for (std::size_t k = 0; k < m; ++k) {
+                const double h = radical_inverse(3, first + k) + s.offset[1];
+                u1[k] = h - std::floor(h);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Replicate loop shared by the 1D and 2D integrators
+ *
+ * Each replicate sums block(u0, u1, m) over its points with chunked_sum,
+ * so the index range is split across threads and the sum does not
+ * depend on the thread count.
+ *
+ * @param block Callable returning the sum of the weighted integrand
+ *        over m unit points (u1 is null in 1D)
+ */
+template <class Block>
+IntegrationResult run_replicates(
+    const char* who,
+    QMCSequence seq,
+    bool randomized,
+    bool two_dim,
+    const SolverParams& p,
+    const Block& block
+)
+{
+    const std::size_t R = randomized ? p.qmc_replicates : 1;
+    if (R == 0 || p.n_samples < R) {
+        throw std::invalid_argument(
+            std::string(who) + ": n_samples must be >= qmc_replicates >= 1"
+        );
+    }
+    const std::size_t N = p.n_samples / R;
+    const std::uint64_t first = randomized ? 0 : 1;
+    if (seq == QMCSequence::Sobol &&
+        first + N > (std::uint64_t{1} << Sobol2D::bits)) {
+        throw std::invalid_argument(
+            std::string(who) + ": too many points per replicate for Sobol"
+        );
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const std::uint64_t seed = p.seed.has_value() ? *p.seed : fresh_seed();
+    const Philox4x32 rng(seed);
+
+    RunningStats reps;
+    for (std::size_t r = 0; r < R; ++r) {
+        Shift s;
+        if (randomized) {
+            double u[2];
+            rng.fill_uniform(2 * r, u, 2);
+            for (int d = 0; d < 2; ++d) {
+                s.digital[d] = static_cast<std::uint32_t>(u[d] * 0x1.0p32);
+                s.offset[d] = u[d];
+            }
+        }
+
+        const double sum = chunked_sum(N, p.n_threads,
+            [&](std::size_t begin, std::size_t end) {
+                double u0[batch_size];
+                double u1[batch_size];
+                double acc = 0.0;
+                for (std::size_t i0 = begin; i0 < end; i0 += batch_size) {
+                    const std::size_t m = std::min(batch_size, end - i0);
+                    fill_points(seq, s, first + i0, m, u0, two_dim ? u1 : nullptr);
+                    acc += block(u0, two_dim ? u1 : nullptr, m);
+                }
+                return acc;
+            });
+        reps.add(sum / static_cast<double>(N));
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
+
+    IntegrationResult res;
+    res.value = reps.mean;
+    res.evaluations = R * N;
+
+    // Standard error over the independent replicates
+    if (p.compute_error_estimate && R > 1) {
+        res.has_error_estimate = true;
+        res.error_estimate = std::sqrt(reps.variance() / static_cast<double>(R));
+    }
+
+    if (p.seed.has_value()) {
+        res.meta["seed"] = static_cast<double>(*p.seed);
+    }
+    res.meta["replicates"] = static_cast<double>(R);
+    res.meta["points_per_replicate"] = static_cast<double>(N);
+    res.meta["threads"] = static_cast<double>(chunked_threads(N, p.n_threads));
+    res.meta["wall_time_s"] = elapsed.count();
+
+    return res;
+}
+
+} // namespace
+
+QuasiMonteCarloSolver::QuasiMonteCarloSolver(QMCSequence sequence, bool randomized)
+    : sequence_(sequence), randomized_(randomized)
+{}
+
+/**
+ * @brief Quasi-Monte Carlo on an interval
+ *
+ * \[
+ * \int_a^b f(x)\,dx \approx \frac{b-a}{N}\sum_{i} f(a + (b-a)\,u_i)
+ * \]
+ */
+IntegrationResult QuasiMonteCarloSolver::integrate(
+    const Function& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    const double a = I.a();
+    const double L = I.length();
+
+    return run_replicates("QuasiMonteCarlo", sequence_, randomized_, false, p,
+        [&](double* u, const double*, std::size_t m) {
+            double ys[batch_size];
+            for (std::size_t k = 0; k < m; ++k) {
+                u[k] = a + L * u[k];
+            }
+            f.evaluate(u, ys, m);
+
+            double s = 0.0;
+            for (std::size_t k = 0; k < m; ++k) {
+                s += ys[k];
+            }
+            return L * s;
+        });
+}
+
+/**
+ * @brief Quasi-Monte Carlo on a 2D domain
+ *
+ * \[
+ * \iint f \approx \frac{1}{N}\sum_i L_x\,h(x_i)\, f(x_i, y_{\min}(x_i) + h(x_i)\,v_i),
+ * \quad h = y_{\max} - y_{\min}
+ * \]
+ */
+IntegrationResult QuasiMonteCarloSolver::integrate(
+    const Function2D& f,
+    const Domain2D& domain,
+    const SolverParams& p
+) const
+{
+    const Interval& Ix = domain.x_interval();
+    const double a = Ix.a();
+    const double L = Ix.length();
+
+    return run_replicates("QuasiMonteCarlo", sequence_, randomized_, true, p,
+        [&](double* u, double* v, std::size_t m) {
+            double ws[batch_size];
+            double fs[batch_size];
+            for (std::size_t k = 0; k < m; ++k) {
+                const double x = a + L * u[k];
+                const double y0 = domain.y_min(x);
+                const double h = domain.y_max(x) - y0;
+                if (!std::isfinite(y0) || !(h >= 0.0) || !std::isfinite(h)) {
+                    throw std::invalid_argument(
+                        "QuasiMonteCarlo: y bounds must be finite with y_min(x) <= y_max(x)"
+                    );
+                }
+                u[k] = x;
+                v[k] = y0 + h * v[k];
+                ws[k] = L * h;
+            }
+            f.evaluate(u, v, fs, m);
+
+            double s = 0.0;
+            for (std::size_t k = 0; k < m; ++k) {
+                s += ws[k] * fs[k];
+            }
+            return s;
+        });
+}
+
+std::string QuasiMonteCarloSolver::name() const {
+    const std::string seq = (sequence_ == QMCSequence::Sobol) ? "Sobol" : "Halton";
+    return (randomized_ ? "RQMC(" : "QMC(") + seq + ")";
+}
+
+} // namespace integ
@@ -0,0 +1,133 @@
+// Romberg.cpp
+#include "solvers/Romberg.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace integ {
+
+namespace {
+
+/// Deepest level: 2^30 subintervals
+constexpr std::size_t max_level = 30;
+
+/// Levels computed before the convergence test is trusted
+constexpr std::size_t min_level = 4;
+
+} // namespace
+
+/**
+ * @brief Integrate using Romberg's method
+ *
+ * Level k uses the trapezoid rule with 2^k subintervals:
+ * \f[
+ * T_k = \tfrac12 T_{k-1} + h_k \sum_{i=1}^{2^{k-1}} f\big(a + (2i - 1) h_k\big),
+ * \quad h_k = \frac{b - a}{2^k},
+ * \f]
+ * so each level only evaluates the 2^{k-1} new midpoints. The tableau
+ * \f[
+ * R_{k,j} = R_{k,j-1} + \frac{R_{k,j-1} - R_{k-1,j-1}}{4^j - 1}
+ * \f]
+ * is extended one row per level and the error is estimated by
+ * |R_{k,k} - R_{k-1,k-1}|.
+ *
+ * Stops when the estimate is below max(abs_tol, rel_tol |R_{k,k}|)
+ * (after at least 4 levels), or when the next level would exceed
+ * p.max_evaluations. Midpoint sums run through chunked_sum on
+ * p.n_threads threads.
+ */
+IntegrationResult RombergSolver::integrate(
+    const Function& f,
+    const Interval& I,
+    const SolverParams& p
+) const
+{
+    if (p.max_evaluations < 2) {
+        throw std::invalid_argument(
+            "Romberg: max_evaluations must be >= 2"
+        );
+    }
+
+    const double a = I.a();
+    const double b = I.b();
+    const double L = I.length();
+
+    double ends_x[2] = { a, b };
+    double ends_y[2];
+    f.evaluate(ends_x, ends_y, 2);
+    std::size_t evals = 2;
+
+    // Two rows of the Richardson tableau
+    std::vector<double> prev{ 0.5 * L * (ends_y[0] + ends_y[1]) };
+    std::vector<double> curr;
+    prev.reserve(max_level + 1);
+    curr.reserve(max_level + 1);
+
+    double estimate = prev[0];
+    double error = std::numeric_limits<double>::infinity();
+    std::size_t level = 0;
+    bool converged = false;
+
+    while (level < max_level) {
+        const std::size_t n_new = std::size_t{1} << level; // new midpoints
+        if (evals + n_new > p.max_evaluations) break;
+        ++level;
+
+        const double h = L / static_cast<double>(std::size_t{1} << level);
+
+        // Only the midpoints a + (2i + 1) h are new
+        auto partial = [&](std::size_t begin, std::size_t end) -> double {
+            double xs[batch_size];
+            double ys[batch_size];
+            double s = 0.0;
+            for (std::size_t i0 = begin; i0 < end; i0 += batch_size) {
+                const std::size_t m = std::min(batch_size, end - i0);
+                for (std::size_t k = 0; k < m; ++k) {
+                    xs[k] = a + h * static_cast<double>(2 * (i0 + k) + 1);
+                }
+                f.evaluate(xs, ys, m);
+                for (std::size_t k = 0; k < m; ++k) {
+                    s += ys[k];
+                }
+            }
+            return s;
+        };
+        const double mid_sum = chunked_sum(n_new, p.n_threads, partial);
+        evals += n_new;
+
+        // Next tableau row
+        curr.assign(1, 0.5 * prev[0] + h * mid_sum);
+        double factor = 1.0;
+        for (std::size_t j = 1; j <= level; ++j) {
+            factor *= 4.0;
+            curr.push_back(curr[j - 1] + (curr[j - 1] - prev[j - 1]) / (factor - 1.0));
+        }
+
+        error = std::abs(curr[level] - prev[level - 1]);
+        estimate = curr[level];
+        std::swap(prev, curr);
+
+        if (level >= min_level &&
+            error <= std::max(p.abs_tol, p.rel_tol * std::abs(estimate))) {
+            converged = true;
+            break;
+        }
+    }
+
+    IntegrationResult res;
+    res.value = estimate;
+    res.evaluations = evals;
+    if (p.compute_error_estimate && level > 0) {
+        res.has_error_estimate = true;
+        res.error_estimate = error;
+    }
+    res.meta["levels"] = static_cast<double>(level);
+    res.meta["converged"] = converged ? 1.0 : 0.0;
+
+    return res;
+}
+
+} // namespace integ
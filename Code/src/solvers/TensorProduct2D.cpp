@@ -0,0 +1,167 @@
+// TensorProduct2D.cpp
+#include "solvers/TensorProduct2D.hpp"
+#include "core/Parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace integ {
+
+namespace {
+
+/// Grid points per tile (three SoA arrays of this size stay in L2)
+constexpr std::size_t tile_points = 4096;
+
+} // namespace
+
+/**
+ * @brief Construct the cubature from two 1D solvers
+ */
+TensorProduct2D::TensorProduct2D(
+    const Solver& x_solver,
+    const Solver& y_solver
+)
+    : x_(x_solver), y_(y_solver)
+{}
+
+/**
+ * @brief Rectangle with fixed rules in both directions
+ */
+bool TensorProduct2D::supports(const Domain2D& domain, const SolverParams& params) const {
+    if (!domain.is_rectangle()) return false;
+    const Interval& Ix = domain.x_interval();
+    const double x0 = Ix.a();
+    const Interval Iy(domain.y_min(x0), domain.y_max(x0));
+    return x_.rule_size(Ix, params) > 0 && y_.rule_size(Iy, params) > 0;
+}
+
+/**
+ * @brief Tensor-product cubature
+ *
+ * Tiles cover up to 512 y-nodes and as many x-nodes as fit in
+ * tile_points. x-tiles are distributed over params.n_threads threads
+ * through chunked_sums, so the value does not depend on the thread
+ * count.
+ *
+ * The error estimate is the one NestedIntegral2D gives for the same
+ * rules, built from the grid values with Solver::rule_error_weights:
+ * sum_i |wx_i| |sum_j ey_j f(x_i, y_j)| for the inner rule plus
+ * |sum_i ex_i g(x_i)| for the outer one, where g(x_i) is the inner sum.
+ */
+IntegrationResult TensorProduct2D::integrate(
+    const Function2D& f,
+    const Domain2D& domain,
+    const SolverParams& params
+) const
+{
+    if (!supports(domain, params)) {
+        throw std::invalid_argument(
+            "TensorProduct2D: needs a rectangular domain and fixed 1D rules"
+        );
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const Interval& Ix = domain.x_interval();
+    const Interval Iy(domain.y_min(Ix.a()), domain.y_max(Ix.a()));
+
+    // Materialize both 1D rules
+    const std::size_t nx = x_.rule_size(Ix, params);
+    const std::size_t ny = y_.rule_size(Iy, params);
+    std::vector<double> xs(nx), wx(nx), ys(ny), wy(ny);
+    x_.rule_nodes(Ix, params, 0, nx, xs.data(), wx.data());
+    y_.rule_nodes(Iy, params, 0, ny, ys.data(), wy.data());
+
+    const std::size_t tile_y = std::min<std::size_t>(ny, 512);
+    const std::size_t tile_x = std::max<std::size_t>(1, tile_points / tile_y);
+
+    // Error weights of the embedded estimates (zero if a rule has none)
+    std::vector<double> ex(nx, 0.0), ey(ny, 0.0);
+    const bool want_error = params.compute_error_estimate;
+    const bool has_ex = want_error && x_.rule_error_weights(Ix, params, 0, nx, ex.data());
+    const bool has_ey = want_error && y_.rule_error_weights(Iy, params, 0, ny, ey.data());
+
+    // |sum_j ey_j f(x_i, y_j)|: inner error estimate at each x-node
+    std::vector<double> inner_err(nx, 0.0);
+
+    // Contribution of x-nodes [begin, end), one x-tile per chunk:
+    // { sum_i wx_i g_i, sum_i ex_i g_i, sum_i |wx_i| inner_err_i }
+    // with g_i = sum_j wy_j f(x_i, y_j)
+    auto partial = [&](std::size_t begin, std::size_t end) {
+        std::vector<double> px(tile_points), py(tile_points), pf(tile_points);
+        std::vector<double> row(end - begin, 0.0);
+        std::vector<double> row_err(end - begin, 0.0);
+
+        for (std::size_t j0 = 0; j0 < ny; j0 += tile_y) {
+            const std::size_t mj = std::min(tile_y, ny - j0);
+
+            // Tile (x_i, y_j) as SoA arrays, y fastest
+            std::size_t k = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                for (std::size_t j = 0; j < mj; ++j, ++k) {
+                    px[k] = xs[i];
+                    py[k] = ys[j0 + j];
+                }
+            }
+            f.evaluate(px.data(), py.data(), pf.data(), k);
+
+            k = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                double s = 0.0;
+                double e = 0.0;
+                for (std::size_t j = 0; j < mj; ++j, ++k) {
+                    s += wy[j0 + j] * pf[k];
+                    e += ey[j0 + j] * pf[k];
+                }
+                row[i - begin] += s;
+                row_err[i - begin] += e;
+            }
+        }
+
+        std::array<double, 3> acc{};
+        for (std::size_t i = begin; i < end; ++i) {
+            const double g = row[i - begin];
+            inner_err[i] = std::abs(row_err[i - begin]);
+            acc[0] += wx[i] * g;
+            acc[1] += ex[i] * g;
+            acc[2] += std::abs(wx[i]) * inner_err[i];
+        }
+        return acc;
+    };
+
+    const auto sums = chunked_sums<3>(nx, params.n_threads, partial, tile_x);
+    const double max_inner_err = *std::max_element(inner_err.begin(), inner_err.end());
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - t0;
+
+    IntegrationResult res;
+    res.value = sums[0];
+    res.evaluations = nx * ny;
+    res.has_error_estimate = false;
+    if (has_ey) {
+        res.has_error_estimate = true;
+        res.error_estimate = sums[2];
+        if (has_ex) {
+            res.error_estimate += std::abs(sums[1]);
+            res.meta["outer_error"] = std::abs(sums[1]);
+        }
+    }
+    res.meta["outer_nodes"] = static_cast<double>(nx);
+    res.meta["inner_calls"] = static_cast<double>(nx);
+    res.meta["total_f_calls"] = static_cast<double>(nx * ny);
+    res.meta["max_inner_error"] = max_inner_err;
+    res.meta["tensor_product"] = 1.0;
+    res.meta["nx"] = static_cast<double>(nx);
+    res.meta["ny"] = static_cast<double>(ny);
+    res.meta["threads"] = static_cast<double>(chunked_threads(nx, params.n_threads, tile_x));
+    res.meta["wall_time_s"] = elapsed.count();
+
+    return res;
+}
+
+} // namespace integ